@@ -9,6 +9,32 @@
 #include <string>
 #include <sstream>
 #include <iterator>
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+#include <limits>
+
+#ifdef _MATRIX_USE_MULTITHREADING
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#endif // _MATRIX_USE_MULTITHREADING
+
+// explicit SIMD kernels are used for the instruction sets the compiler has been told to target
+#if !defined(_MATRIX_DISABLE_SIMD) && defined(__AVX2__)
+#define _MATRIX_SIMD_AVX2
+#define _MATRIX_SIMD
+#include <immintrin.h>
+#elif !defined(_MATRIX_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define _MATRIX_SIMD_SSE2
+#define _MATRIX_SIMD
+#include <emmintrin.h>
+#ifdef __FMA__
+// the 128 bit FMA instructions are declared together with AVX
+#include <immintrin.h>
+#endif // __FMA__
+#endif // !defined(_MATRIX_DISABLE_SIMD)
 
 // using manually unrolled loop for common size matrices will increase speed by ~40%,
 // so we use it if we are in release mode
@@ -41,10 +67,132 @@
 #define _MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N 4
 #endif // !_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N
 
+// number of columns of B which the multiplication kernel stores next to each other in one panel
+#ifndef _MATRIX_PACKED_PANEL_WIDTH
+#define _MATRIX_PACKED_PANEL_WIDTH 8
+#endif // !_MATRIX_PACKED_PANEL_WIDTH
+
+// number of rows of A which the multiplication kernel processes at once
+#ifndef _MATRIX_PACKED_PANEL_HEIGHT
+#define _MATRIX_PACKED_PANEL_HEIGHT 4
+#endif // !_MATRIX_PACKED_PANEL_HEIGHT
+
+// Mul() packs B on the fly if A has at least this many rows, otherwise packing isn't worth it
+#ifndef _MATRIX_PACKED_MUL_MIN_ROWS
+#define _MATRIX_PACKED_MUL_MIN_ROWS 8
+#endif // !_MATRIX_PACKED_MUL_MIN_ROWS
+
+// accuracy of ExpEBE(), LogEBE(), PowEBE(), ... for all calls with Accuracy::Default
+#ifndef _MATRIX_DEFAULT_ACCURACY
+#define _MATRIX_DEFAULT_ACCURACY Standard
+#endif // !_MATRIX_DEFAULT_ACCURACY
+
+// element-by-element operations on at least this many elements are split across the worker pool
+#ifndef _MATRIX_PARALLEL_THRESHOLD
+#define _MATRIX_PARALLEL_THRESHOLD 262144
+#endif // !_MATRIX_PARALLEL_THRESHOLD
+
+// outputs of at least this many bytes are written with non-temporal stores, which bypass the caches
+#ifndef _MATRIX_STREAMING_THRESHOLD
+#define _MATRIX_STREAMING_THRESHOLD 8388608
+#endif // !_MATRIX_STREAMING_THRESHOLD
+
 
 namespace Matrix
 {
+    // Selects how accurate the transcendental functions (ExpEBE, LogEBE, PowEBE, ...) are calculated
+    enum class Accuracy
+    {
+        Default,            // the accuracy set with SetDefaultAccuracy()
+        Standard,           // the standard library in the element type, e.g. std::exp(float), like before the SIMD kernels
+        Ulp1,               // SIMD kernels with an error of at most 1 ULP
+        Fast,               // SIMD kernels with an error of about 4 ULP
+    };
+
+    // Selects when Add(), Sub(), MulEBE(), DivEBE(), Transpose180deg(), clear() and the scalar assignment write
+    // their output with non-temporal stores. These don't read the destination into the cache first, which saves
+    // memory bandwidth for outputs which are too large to stay in the cache anyway.
+    enum class StreamingStores
+    {
+        Auto,               // outputs of at least _MATRIX_STREAMING_THRESHOLD bytes
+        Always,
+        Never,
+    };
+
+    // Selects how Sum(), Dot() and Norm() add up floating point numbers
+    enum class Summation
+    {
+        Fast,               // several SIMD accumulators, the rounding error grows with the number of elements
+        Pairwise,           // blocks of the fast summation are added up pairwise, the error grows with log(elements)
+        Compensated,        // second order Neumaier summation in every SIMD lane, the error doesn't grow with the number of elements
+    };
+
+    // Selects the norm of Norm(), all of them treat the matrix as one vector of its elements
+    enum class NormType
+    {
+        L1,                 // sum of |a|
+        L2,                 // sqrt(sum of a^2), the same as Frobenius
+        Inf,                // max |a|
+        Frobenius,
+    };
+
+    // The type Sum() and Dot() return: integers are added up in 64 bit, all other types in their own type
+    template<typename _Elem>
+    using SumType = typename std::conditional<std::is_integral<_Elem>::value,
+        typename std::conditional<std::is_signed<_Elem>::value, int64_t, uint64_t>::type, _Elem>::type;
+
+    // The type Norm() returns: float and double themselves, everything else double
+    template<typename _Elem>
+    using NormResult = typename std::conditional<std::is_floating_point<_Elem>::value, _Elem, double>::type;
+
+    // Selects what ReduceRows() and ReduceCols() calculate for every row or column
+    enum class Reduction
+    {
+        Sum,
+        Mean,               // integers are divided in double
+        Min,                // NaNs are ignored
+        Max,
+        Norm,               // sqrt(sum of a^2)
+    };
+
+    // Selects the comparison of Compare()
+    enum class Comparison
+    {
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual,           // the only comparison which is true for NaN
+    };
+
+    // Selects the axis of FlippedView()
+    enum class Flip
+    {
+        Horizontal,         // mirrors left and right, every row is reversed
+        Vertical,           // mirrors top and bottom, the order of the rows is reversed
+    };
+
+    // Selects how Convert() and the converting constructor turn one element type into another
+    enum class Conversion
+    {
+        Truncate,           // _ElemB(a), floating point values are rounded towards 0
+        Round,              // floating point values are rounded to the nearest integer, ties to even
+        Saturate,           // like Round, but integers are clamped to the range of the destination and NaN becomes 0
+    };
+
+    // Selects the order of SortRows(), SortCols(), ArgSortRows() and TopKPerRow(). NaNs are placed last in
+    // both orders and equal elements keep their order.
+    enum class SortOrder
+    {
+        Ascending,
+        Descending,
+    };
+
     template<typename _Elem, size_t _Rows, size_t _Cols>
+    class MatrixView;
+
+    template<typename _Elem, size_t _Rows, size_t _Cols>
     class Matrix2D
     {
     public:
@@ -52,13 +200,16 @@ namespace Matrix
         Matrix2D(_Elem*);
         template <typename _ElemB> Matrix2D(const _ElemB);
         Matrix2D(const Matrix2D&);
-        template <typename _ElemB> Matrix2D(Matrix2D<_ElemB, _Rows, _Cols>&);
+        Matrix2D(Matrix2D&&);
+        template <typename _ElemB> Matrix2D(Matrix2D<_ElemB, _Rows, _Cols>&, const Conversion method = Conversion::Truncate);
         Matrix2D(const std::initializer_list<std::initializer_list<_Elem>>);
         ~Matrix2D(void);
 
         Matrix2D& operator = (const Matrix2D&);
+        Matrix2D& operator = (Matrix2D&&);
         Matrix2D& operator = (_Elem*);
         Matrix2D& operator = (const _Elem);
+        template <typename _ElemB> Matrix2D& operator = (Matrix2D<_ElemB, _Rows, _Cols>&);
         template <typename _ElemB> _ElemB* operator + (Matrix2D<_ElemB, _Rows, _Cols>&);
         template <typename _ElemB> _ElemB* operator - (Matrix2D<_ElemB, _Rows, _Cols>&);
         _Elem* operator * (Matrix2D&) = delete; // unable to ensure that both matrices have the correct size. Please use Matrix::Mul()
@@ -100,6 +251,15 @@ namespace Matrix
 
         template<typename _Cast = _Elem> void cout(void);
         void clear(void);
+
+        // Gives up the ownership of the buffer, the counterpart of Matrix2D(_Elem*). The matrix can only be assigned
+        // (which allocates a new buffer) or destroyed afterwards.
+        _Elem* release(void);
+
+        // The same elements as a _NewRows x _NewCols matrix. Borrows the buffer as a view for lvalues and moves it
+        // into the result for rvalues, e.g. auto row = std::move(A).Reshape<1, _Rows * _Cols>(). Nothing is copied.
+        template<size_t _NewRows, size_t _NewCols> MatrixView<_Elem, _NewRows, _NewCols> Reshape(void) &;
+        template<size_t _NewRows, size_t _NewCols> Matrix2D<_Elem, _NewRows, _NewCols> Reshape(void) &&;
 
         template <typename element, size_t rows, size_t columns>
         void Print(Matrix2D<element, rows, columns>& mat);
@@ -154,23 +314,23 @@ namespace Matrix
 
         // A .^ B = C
         template<typename _ElemA, typename _ElemB>
-        static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C);
+        static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C, const Accuracy accuracy = Accuracy::Default);
 
         // A .^ scalar = B
         template<typename _ElemA, typename _ElemB>
-        static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B);
+        static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
         // scalar .* A = B
         template<typename _ElemA, typename _ElemB>
-        static void PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B);
+        static void PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
         // A .exp = B
         template<typename _ElemA>
-        static void ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B);
+        static void ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
         // A .sqrt = B
         template<typename _ElemA>
-        static void SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B);
+        static void SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
     private:
         _Elem* p_mat;
@@ -204,10 +364,297 @@ namespace Matrix
         return (row * _Width) + column;
     }
 
+    // Selects the triangle of a square matrix that an operation reads or writes
+    enum class Triangle
+    {
+        Lower,  // elements with column <= row
+        Upper,  // elements with column >= row
+    };
+
+    // Selects on which side of the other operand a triangular matrix is used
+    enum class Side
+    {
+        Left,   // T * B
+        Right,  // B * T
+    };
+
+    // Tells if the diagonal of a triangular matrix is stored or assumed to be 1
+    enum class Diagonal
+    {
+        NonUnit,
+        Unit,
+    };
+
+    // Selects how complex matrices are multiplied
+    enum class ComplexMethod
+    {
+        FourM,  // 4 real multiplications: Re = ArBr - AiBi, Im = ArBi + AiBr
+        ThreeM, // 3 real multiplications: Re = ArBr - AiBi, Im = (Ar + Ai)(Br + Bi) - ArBr - AiBi. Faster, Re is the same as FourM but Im is less accurate
+    };
+
+    // Tells a PackedMatrix on which side of a multiplication it will be used
+    enum class PackedOperand
+    {
+        Left,   // A in A * B = C
+        Right,  // B in A * B = C
+    };
+
+    // A matrix that has been rearranged once into the panel layout of the multiplication kernel.
+    // Use it for operands which are multiplied many times (e.g. constant weights), so Mul() 
+    // doesn't need to pack them again on every call.
+    template<typename _Elem, size_t _Rows, size_t _Cols, PackedOperand _Operand = PackedOperand::Right>
+    class PackedMatrix
+    {
+    public:
+        PackedMatrix(void) = delete;
+        template <typename _ElemB> PackedMatrix(Matrix2D<_ElemB, _Rows, _Cols>&);
+        PackedMatrix(const PackedMatrix&);
+        ~PackedMatrix(void);
+
+        PackedMatrix& operator = (const PackedMatrix&);
+
+        // packs the matrix again, e.g. after the source matrix has changed
+        template <typename _ElemB> void Pack(Matrix2D<_ElemB, _Rows, _Cols>&);
+
+        _INLINE const _Elem* data(void) const { return p_pack; }
+
+        // right operands are split into panels of columns, left operands into panels of rows
+        const static size_t c_panel_size = (_Operand == PackedOperand::Right) ? _MATRIX_PACKED_PANEL_WIDTH : _MATRIX_PACKED_PANEL_HEIGHT;
+        const static size_t c_panels = (((_Operand == PackedOperand::Right) ? _Cols : _Rows) + c_panel_size - 1) / c_panel_size;
+        const static size_t c_elements = c_panels * c_panel_size * ((_Operand == PackedOperand::Right) ? _Rows : _Cols);
+
+    private:
+        _Elem* p_pack;
+    };
+
+    // A complex matrix with the real and imaginary parts stored in two separate matrices, so 
+    // the kernels can work on plain real numbers
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    class SplitComplexMatrix
+    {
+    public:
+        SplitComplexMatrix(void);
+        SplitComplexMatrix(Matrix2D<std::complex<_Elem>, _Rows, _Cols>&);
+
+        _INLINE Matrix2D<_Elem, _Rows, _Cols>& real(void) { return m_real; }
+        _INLINE Matrix2D<_Elem, _Rows, _Cols>& imag(void) { return m_imag; }
+
+    private:
+        Matrix2D<_Elem, _Rows, _Cols> m_real;
+        Matrix2D<_Elem, _Rows, _Cols> m_imag;
+    };
+
+    // The Kronecker product A (x) B without creating it. Multiplying it with a matrix or vector
+    // only needs A and B, which have to outlive the operator.
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB>
+    class KronOperator
+    {
+    public:
+        KronOperator(void) = delete;
+        KronOperator(Matrix2D<_ElemA, _RowsA, _ColsA>&, Matrix2D<_ElemB, _RowsB, _ColsB>&);
+
+        // (A (x) B) * X = Y, X may have any number of columns
+        template<typename _ElemX, size_t _ColsX, typename _ElemY>
+        void Apply(Matrix2D<_ElemX, _ColsA * _ColsB, _ColsX>& X, Matrix2D<_ElemY, _RowsA * _RowsB, _ColsX>& Y);
+
+        const static size_t c_rows = _RowsA * _RowsB;
+        const static size_t c_cols = _ColsA * _ColsB;
+
+    private:
+        Matrix2D<_ElemA, _RowsA, _ColsA>& r_a;
+        Matrix2D<_ElemB, _RowsB, _ColsB>& r_b;
+    };
+
+    // One bit per element of a _Rows x _Cols matrix, e.g. the result of Compare(). The bits are stored row by row in
+    // 64 bit words, element i is bit (i % 64) of word (i / 64). The bits behind the last element are always 0.
+    template<size_t _Rows, size_t _Cols>
+    class Mask2D
+    {
+    public:
+        Mask2D(void) = delete;
+        Mask2D(const bool value);
+        Mask2D(const Mask2D&);
+        ~Mask2D(void);
+
+        Mask2D& operator = (const Mask2D&);
+        Mask2D& operator = (const bool);
+
+        _INLINE bool operator [] (const size_t index) const { return ((p_words[index / 64] >> (index % 64)) & 1) != 0; }
+        _INLINE bool at(const size_t row, const size_t column) const { return (*this)[(row * _Cols) + column]; }
+        void set(const size_t index, const bool value);
+
+        _INLINE uint64_t* data(void) { return p_words; }
+
+        const static size_t c_elements = _Rows * _Cols;
+        const static size_t c_words = (c_elements + 63) / 64;
+
+    private:
+        uint64_t* p_words;
+    };
+
+    // A _Rows x _Cols window onto the elements of another matrix, element (row, column) is
+    // base[row * row_stride + column * col_stride]. Transposed, rotated and flipped views are only a different
+    // base and strides, nothing is copied. Writes go to the viewed matrix, which has to outlive the view.
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    class MatrixView
+    {
+    public:
+        MatrixView(void) = delete;
+        MatrixView(_Elem* base, const ptrdiff_t row_stride, const ptrdiff_t col_stride);
+
+        _INLINE _Elem& at(const size_t row, const size_t column) const { return p_base[(ptrdiff_t(row) * m_row_stride) + (ptrdiff_t(column) * m_col_stride)]; }
+
+        _INLINE _Elem* base(void) const { return p_base; }
+        _INLINE ptrdiff_t row_stride(void) const { return m_row_stride; }
+        _INLINE ptrdiff_t col_stride(void) const { return m_col_stride; }
+
+        const static size_t c_rows = _Rows;
+        const static size_t c_cols = _Cols;
+
+    private:
+        _Elem* p_base;
+        ptrdiff_t m_row_stride;
+        ptrdiff_t m_col_stride;
+    };
+
     // A * B = C
     template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
     static void Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
 
+    // A * B = C for a view A, e.g. Mul(TransposedView(X), B, C)
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+    static void Mul(const MatrixView<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
+
+    // A * B = C for a view B, e.g. Mul(A, TransposedView(X), C). Costs the same as a plain matrix B.
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+    static void Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, const MatrixView<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
+
+    // A * B = C for two views
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+    static void Mul(const MatrixView<_ElemA, _RowsA, _ColsA>& A, const MatrixView<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
+
+    // A * B = C, B has been packed in advance
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+    static void Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, PackedMatrix<_ElemB, _ColsA, _ColsB, PackedOperand::Right>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
+
+    // A * B = C, A has been packed in advance
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+    static void Mul(PackedMatrix<_ElemA, _RowsA, _ColsA, PackedOperand::Left>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C);
+
+    // alpha * A * A^T + beta * C = C, only [triangle] of C is calculated. If [mirror] is set,
+    // the result is copied into the other triangle as well. A^T is never created.
+    template<typename _ElemAlpha, typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemBeta, typename _ElemC>
+    static void Syrk(const _ElemAlpha alpha, Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemBeta beta, Matrix2D<_ElemC, _Rows, _Rows>& C, const Triangle triangle = Triangle::Lower, const bool mirror = true);
+
+    // A * A^T = C, only [triangle] of C is calculated and mirrored into the other one if [mirror] is set
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemC>
+    static void Gram(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemC, _Rows, _Rows>& C, const Triangle triangle = Triangle::Lower, const bool mirror = true);
+
+    // T * B = C (Side::Left) or B * T = C (Side::Right), only [_Triangle] of T is read. With Diagonal::Unit the
+    // diagonal of T is assumed to be 1. B and C may be the same object.
+    template<Side _Side, Triangle _Triangle, Diagonal _Diagonal = Diagonal::NonUnit, typename _ElemT, size_t _N, typename _ElemB, size_t _Rows, size_t _Cols, typename _ElemC>
+    static void TriMul(Matrix2D<_ElemT, _N, _N>& T, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // Solving T * X = B (Side::Left) or X * T = B (Side::Right) and storing X in C, only [_Triangle] of T is read.
+    // With Diagonal::Unit the diagonal of T is assumed to be 1. B and C may be the same object.
+    template<Side _Side, Triangle _Triangle, Diagonal _Diagonal = Diagonal::NonUnit, typename _ElemT, size_t _N, typename _ElemB, size_t _Rows, size_t _Cols, typename _ElemC>
+    static void TriSolve(Matrix2D<_ElemT, _N, _N>& T, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // (A (x) B) * X = Y, with the Kronecker product from a KronOperator
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB, typename _ElemX, size_t _ColsX, typename _ElemY>
+    static void Mul(KronOperator<_ElemA, _RowsA, _ColsA, _ElemB, _RowsB, _ColsB>& K, Matrix2D<_ElemX, _ColsA * _ColsB, _ColsX>& X, Matrix2D<_ElemY, _RowsA * _RowsB, _ColsX>& Y);
+
+    // A * B = C for complex matrices, the real and imaginary parts are multiplied separately
+    template<typename _Elem, size_t _RowsA, size_t _ColsA, size_t _ColsB>
+    static void Mul(Matrix2D<std::complex<_Elem>, _RowsA, _ColsA>& A, Matrix2D<std::complex<_Elem>, _ColsA, _ColsB>& B, Matrix2D<std::complex<_Elem>, _RowsA, _ColsB>& C, const ComplexMethod method = ComplexMethod::FourM);
+
+    // A * B = C for complex matrices in split layout
+    template<typename _Elem, size_t _RowsA, size_t _ColsA, size_t _ColsB>
+    static void Mul(SplitComplexMatrix<_Elem, _RowsA, _ColsA>& A, SplitComplexMatrix<_Elem, _ColsA, _ColsB>& B, SplitComplexMatrix<_Elem, _RowsA, _ColsB>& C, const ComplexMethod method = ComplexMethod::FourM);
+
+    // Converting the complex matrix A into the split layout B
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static void ToSplit(Matrix2D<std::complex<_Elem>, _Rows, _Cols>& A, SplitComplexMatrix<_Elem, _Rows, _Cols>& B);
+
+    // Converting the split layout A back into the complex matrix B
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static void FromSplit(SplitComplexMatrix<_Elem, _Rows, _Cols>& A, Matrix2D<std::complex<_Elem>, _Rows, _Cols>& B);
+
+    // A (x) B = C, the Kronecker product
+    template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB, typename _ElemC>
+    static void Kron(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _RowsB, _ColsB>& B, Matrix2D<_ElemC, _RowsA * _RowsB, _ColsA * _ColsB>& C);
+
+    // Places all blocks along the diagonal of C and sets everything else to 0. Unlike the other
+    // functions the destination comes first, followed by any number of blocks.
+    template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+    static void BlockDiag(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks);
+
+    // Copies the block of A which starts at (_Row0, _Col0) and has the size of B into B: ExtractBlock<2, 3>(A, B);
+    template<size_t _Row0, size_t _Col0, typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB>
+    static void ExtractBlock(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _RowsB, _ColsB>& B);
+
+    // Copies A into the block of C which starts at (_Row0, _Col0), the rest of C is kept: InsertBlock<2, 3>(A, C);
+    template<size_t _Row0, size_t _Col0, typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemC, size_t _RowsC, size_t _ColsC>
+    static void InsertBlock(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemC, _RowsC, _ColsC>& C);
+
+    // Places all blocks next to each other in C, [ A B ... ]. Like BlockDiag() the destination comes first.
+    template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+    static void HStack(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks);
+
+    // Places all blocks below each other in C, [ A; B; ... ]. Like BlockDiag() the destination comes first.
+    template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+    static void VStack(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks);
+
+    // Converts every element of A into the type of B with the semantics of [method], e.g. Conversion::Saturate
+    // clamps float to [0, 255] for uint8_t
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void Convert(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Conversion method = Conversion::Truncate);
+
+    // Every row of B is the same row of A, sorted
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void SortRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const SortOrder order = SortOrder::Ascending);
+
+    // Every column of B is the same column of A, sorted
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void SortCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const SortOrder order = SortOrder::Ascending);
+
+    // Row i of indices holds the column indices which sort row i of A: A(i, indices(i, 0)) comes first
+    template<typename _Elem, size_t _Rows, size_t _Cols, typename _Index>
+    static void ArgSortRows(Matrix2D<_Elem, _Rows, _Cols>& A, Matrix2D<_Index, _Rows, _Cols>& indices, const SortOrder order = SortOrder::Ascending);
+
+    // The k largest (or with SortOrder::Ascending the k smallest) elements of every row of A and their column
+    // indices, best first. k is the column count of B and indices.
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, size_t _K, typename _Index>
+    static void TopKPerRow(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _K>& B, Matrix2D<_Index, _Rows, _K>& indices, const SortOrder order = SortOrder::Descending);
+
+    // B(i, j) = A(i, 0) + ... + A(i, j). B should be wide enough for the sums, e.g. uint32_t for uint8_t.
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void CumSumRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // B(i, j) = A(0, j) + ... + A(i, j)
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void CumSumCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // B(i, j) is the sum of A from (0, 0) to (i, j), the summed-area table for BoxSum()
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void IntegralImage(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // The sum of the [rows] x [cols] block of A starting at (row0, col0), read from the integral image of A
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static _Elem BoxSum(Matrix2D<_Elem, _Rows, _Cols>& integral, const size_t row0, const size_t col0, const size_t rows, const size_t cols);
+
+    // Row i of B becomes row indices[i] of A. Rows of B with an index outside [0, _RowsA) are kept.
+    template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, size_t _RowsB, typename _ElemB>
+    static void GatherRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsB, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B);
+
+    // Row indices[i] of B becomes row i of A, if an index repeats the last row wins. Other rows of B are kept.
+    template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, typename _ElemB, size_t _RowsB>
+    static void ScatterRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsA, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B);
+
+    // Adds row i of A to row indices[i] of B, repeated indices accumulate
+    template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, typename _ElemB, size_t _RowsB>
+    static void ScatterAddRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsA, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B);
+
     // A + B = C
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
     static void Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
@@ -248,25 +695,210 @@ namespace Matrix
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
     static void DivEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_ElemC, _Rows, _Cols>& B);
 
+    // Broadcasting versions of the functions above: a 1 x _Cols matrix B is applied to every row of A, a
+    // _Rows x 1 matrix B to every column of A. Matrices with one row or column use the normal versions.
+
+    // A + B = C, B is added to every row
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type = 0>
+    static void Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A + B = C, B is added to every column
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type = 0>
+    static void Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A - B = C, B is subtracted from every row
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type = 0>
+    static void Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A - B = C, B is subtracted from every column
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type = 0>
+    static void Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A .* B = C, every row is multiplied by B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type = 0>
+    static void MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A .* B = C, every column is multiplied by B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type = 0>
+    static void MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A ./ B = C, every row is divided by B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type = 0>
+    static void DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A ./ B = C, every column is divided by B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type = 0>
+    static void DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
     //  A .pow B = C
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-    static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+    static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, const Accuracy accuracy = Accuracy::Default);
 
     // A .pow scalar = B
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB = void, typename _ElemC>
-    static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>& B);
+    static void PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
     // scalar .pow A = B
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-    static void PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_ElemC, _Rows, _Cols>& B);
+    static void PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_ElemC, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
     // A .exp = B
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-    static void ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+    static void ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
+
+    // A .log = B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void LogEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
 
     // A .sqrt = B
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-    static void SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+    static void SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
+
+    // 1 ./ A .sqrt = B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void RsqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
+
+    // A .tanh = B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void TanhEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
+
+    // 1 ./ (1 + exp(-A)) = B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void SigmoidEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Accuracy accuracy = Accuracy::Default);
+
+    // Sets the accuracy of all calls with Accuracy::Default, Accuracy::Default itself restores _MATRIX_DEFAULT_ACCURACY.
+    // Don't change it while other threads are calculating.
+    inline void SetDefaultAccuracy(const Accuracy accuracy);
+    inline Accuracy GetDefaultAccuracy(void);
+
+    // Sets the number of elements from which element-by-element operations, clear() and the scalar assignment
+    // run on all hardware threads, 0 restores _MATRIX_PARALLEL_THRESHOLD. Only has an effect with _MATRIX_USE_MULTITHREADING.
+    // Don't change it while other threads are calculating.
+    inline void SetParallelThreshold(const size_t elements);
+    inline size_t GetParallelThreshold(void);
+
+    // Overrides when non-temporal stores are used, StreamingStores::Auto is the default.
+    // Don't change it while other threads are calculating.
+    inline void SetStreamingStores(const StreamingStores mode);
+    inline StreamingStores GetStreamingStores(void);
+
+    // sum of all elements of A
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static SumType<_Elem> Sum(Matrix2D<_Elem, _Rows, _Cols>& A, const Summation summation = Summation::Fast);
+
+    // smallest element of A, NaNs are ignored
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static _Elem Min(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // largest element of A, NaNs are ignored
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static _Elem Max(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // index (row * columns + column) of the first smallest element of A
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static size_t ArgMin(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // index (row * columns + column) of the first largest element of A
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static size_t ArgMax(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // sum of A .* B
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static SumType<decltype(std::declval<_ElemA>() * std::declval<_ElemB>())> Dot(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Summation summation = Summation::Fast);
+
+    // ||A||, see NormType
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static NormResult<_Elem> Norm(Matrix2D<_Elem, _Rows, _Cols>& A, const NormType type = NormType::L2, const Summation summation = Summation::Fast);
+
+    // B(row) = reduction of the row of A
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void ReduceRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, const Reduction reduction = Reduction::Sum);
+
+    // B(col) = reduction of the column of A
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void ReduceCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, const Reduction reduction = Reduction::Sum);
+
+    // true if every |a - b| <= max(abs_tolerance, rel_tolerance * max(|a|, |b|)). Unlike operator == it treats 0.0 and
+    // -0.0 as equal and NaN as unequal to everything. Stops at the first element which isn't equal.
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static bool ApproxEqual(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const double abs_tolerance, const double rel_tolerance = 0.0);
+
+    // true if every a and b are at most max_ulps representable floating point numbers apart, NaN is unequal to everything
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static bool ApproxEqualUlps(Matrix2D<_Elem, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const uint64_t max_ulps);
+
+    // 64 bit hash (XXH64) of the content of A. Bitwise like operator ==, so 0.0 and -0.0 have different hashes.
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static uint64_t Hash(Matrix2D<_Elem, _Rows, _Cols>& A, const uint64_t seed = 0);
+
+    // mask(i) = A(i) [comparison] B(i)
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void Compare(Matrix2D<_ElemA, _Rows, _Cols>& A, const Comparison comparison, Matrix2D<_ElemB, _Rows, _Cols>& B, Mask2D<_Rows, _Cols>& mask);
+
+    // mask(i) = A(i) [comparison] scalar
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void Compare(Matrix2D<_ElemA, _Rows, _Cols>& A, const Comparison comparison, const _ElemB scalar, Mask2D<_Rows, _Cols>& mask);
+
+    // C(i) = mask(i) ? A(i) : B(i)
+    template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB, typename _ElemC>
+    static void Where(Mask2D<_Rows, _Cols>& mask, Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // B(i) = A(i) where mask(i) is set, the other elements of B are kept
+    template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB>
+    static void MaskedAssign(Mask2D<_Rows, _Cols>& mask, Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // B(i) = scalar where mask(i) is set, the other elements of B are kept
+    template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB>
+    static void MaskedAssign(Mask2D<_Rows, _Cols>& mask, const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // number of set elements of the mask
+    template<size_t _Rows, size_t _Cols>
+    static size_t CountTrue(Mask2D<_Rows, _Cols>& mask);
+
+    // indices (row * columns + column) of the set elements in ascending order, [indices] is resized to their number
+    template<size_t _Rows, size_t _Cols>
+    static void MaskedIndices(Mask2D<_Rows, _Cols>& mask, std::vector<size_t>& indices);
+
+    // f(A) = B, element-by-element with any function or lambda, e.g. [](float x) { return x * x + 1; }.
+    // With _MATRIX_USE_MULTITHREADING f is called from several threads at once.
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _Func, typename _ElemB>
+    static void Map(Matrix2D<_ElemA, _Rows, _Cols>& A, _Func f, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // f(A, B) = C, element-by-element
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _Func, typename _ElemC>
+    static void ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, _Func f, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // f(A, B, C) = D, element-by-element
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _Func, typename _ElemD>
+    static void ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, _Func f, Matrix2D<_ElemD, _Rows, _Cols>& D);
+
+    // f(A, B, C, D) = E, element-by-element
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _ElemD, typename _Func, typename _ElemE>
+    static void ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, Matrix2D<_ElemD, _Rows, _Cols>& D, _Func f, Matrix2D<_ElemE, _Rows, _Cols>& E);
+
+    // A .* B + C = D, in one pass and with one rounding on CPUs with FMA instructions
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _ElemD>
+    static void FmaEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, Matrix2D<_ElemD, _Rows, _Cols>& D);
+
+    // alpha * X + Y = Y
+    template<typename _Alpha, typename _ElemX, size_t _Rows, size_t _Cols, typename _ElemY>
+    static void Axpy(const _Alpha alpha, Matrix2D<_ElemX, _Rows, _Cols>& X, Matrix2D<_ElemY, _Rows, _Cols>& Y);
+
+    // alpha * X + beta * Y = Y
+    template<typename _Alpha, typename _ElemX, size_t _Rows, size_t _Cols, typename _Beta, typename _ElemY>
+    static void Axpby(const _Alpha alpha, Matrix2D<_ElemX, _Rows, _Cols>& X, const _Beta beta, Matrix2D<_ElemY, _Rows, _Cols>& Y);
+
+    // A + t * (B - A) = C
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemT, typename _ElemC>
+    static void LerpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const _ElemT t, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A + T .* (B - A) = C
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemT, typename _ElemC>
+    static void LerpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemT, _Rows, _Cols>& T, Matrix2D<_ElemC, _Rows, _Cols>& C);
+
+    // A^T = B, B(i, j) = A(j, i)
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void Transpose(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Cols, _Rows>& B);
 
     // Transpose matrix 90 degrees to the right
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
@@ -279,6 +911,78 @@ namespace Matrix
     // Transpose matrix 270 degrees to the right, or 90 degrees to the left
     template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
     static void Transpose270deg(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Cols, _Rows>& B);
+
+    // A = A^T in place for square matrices
+    template<typename _Elem, size_t _Size>
+    static void Transpose(Matrix2D<_Elem, _Size, _Size>& A);
+
+    // Rotate a square matrix 90 degrees to the right in place
+    template<typename _Elem, size_t _Size>
+    static void Transpose90deg(Matrix2D<_Elem, _Size, _Size>& A);
+
+    // Rotate a matrix 180 degrees in place
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static void Transpose180deg(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // Rotate a square matrix 270 degrees to the right in place
+    template<typename _Elem, size_t _Size>
+    static void Transpose270deg(Matrix2D<_Elem, _Size, _Size>& A);
+
+    // A^T of any shape without a second buffer, the buffer of A is moved into the result: auto B = TransposeInPlace(std::move(A));
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static Matrix2D<_Elem, _Cols, _Rows> TransposeInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A);
+
+    // Transpose90deg() of any shape without a second buffer, the buffer of A is moved into the result
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static Matrix2D<_Elem, _Cols, _Rows> Transpose90degInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A);
+
+    // Transpose270deg() of any shape without a second buffer, the buffer of A is moved into the result
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static Matrix2D<_Elem, _Cols, _Rows> Transpose270degInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A);
+
+    // B(i, j) = A(i, _Cols - 1 - j), mirrors left and right
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void FlipHorizontal(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // B(i, j) = A(_Rows - 1 - i, j), mirrors top and bottom
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void FlipVertical(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
+
+    // Mirror A left and right in place
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static void FlipHorizontal(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // Mirror A top and bottom in place
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static void FlipVertical(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // view of A^T
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Cols, _Rows> TransposedView(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // view of the transposed view A
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Cols, _Rows> TransposedView(const MatrixView<_Elem, _Rows, _Cols>& A);
+
+    // view of A rotated 90 degrees to the right, like Transpose90deg()
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Cols, _Rows> Rotated90View(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // view of A rotated 180 degrees, like Transpose180deg()
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Rows, _Cols> Rotated180View(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // view of A rotated 270 degrees to the right, like Transpose270deg()
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Cols, _Rows> Rotated270View(Matrix2D<_Elem, _Rows, _Cols>& A);
+
+    // view of A mirrored along the [axis]
+    template<typename _Elem, size_t _Rows, size_t _Cols>
+    static MatrixView<_Elem, _Rows, _Cols> FlippedView(Matrix2D<_Elem, _Rows, _Cols>& A, const Flip axis);
+
+    // copies the elements of the view A into B, views which swap rows and columns use the blocked transpose
+    template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+    static void Materialize(const MatrixView<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B);
 }
 
 #undef _INLINE
@@ -287,100 +991,4336 @@ namespace Matrix
 #define _INLINE _MATRIX_INLINE_TMP
 #undef _MATRIX_INLINE_TMP
 #endif // _MATRIX_INLINE_TMP
-
-
-//
-///
-//// Function Definitions:
+
+
+//
+///
+//// Internal Kernels:
 ///
 //
 
-
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemB>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const _ElemB init) :
-    p_mat(new _Elem[_Rows * _Cols])
+namespace Matrix
 {
-    for (size_t i = 0; i < c_elements; i++)
-        p_mat[i] = _Elem(init);
-}
+    namespace Internal
+    {
+        constexpr size_t c_panel_width = _MATRIX_PACKED_PANEL_WIDTH;
+        constexpr size_t c_panel_height = _MATRIX_PACKED_PANEL_HEIGHT;
+
+        // Copies B (rows x cols) into panels of [c_panel_width] columns. Each panel is stored row by row,
+        // so the kernel can read it strictly sequential. The last panel is padded with zeros.
+        template<typename _ElemSrc, typename _ElemDst>
+        inline void PackRightOperand(const _ElemSrc* src, const size_t rows, const size_t cols, _ElemDst* dst)
+        {
+            for (size_t col0 = 0; col0 < cols; col0 += c_panel_width)
+            {
+                const size_t width = std::min(c_panel_width, cols - col0);
+
+                for (size_t row = 0; row < rows; row++, dst += c_panel_width)
+                {
+                    for (size_t col = 0; col < width; col++)
+                        dst[col] = _ElemDst(src[(row * cols) + col0 + col]);
+                    for (size_t col = width; col < c_panel_width; col++)
+                        dst[col] = _ElemDst(0);
+                }
+            }
+        }
+
+        // Copies A (rows x cols) into panels of [c_panel_height] rows. Each panel is stored column by column.
+        // The last panel is padded with zeros.
+        template<typename _ElemSrc, typename _ElemDst>
+        inline void PackLeftOperand(const _ElemSrc* src, const size_t rows, const size_t cols, _ElemDst* dst)
+        {
+            for (size_t row0 = 0; row0 < rows; row0 += c_panel_height)
+            {
+                const size_t height = std::min(c_panel_height, rows - row0);
+
+                for (size_t col = 0; col < cols; col++, dst += c_panel_height)
+                {
+                    for (size_t row = 0; row < height; row++)
+                        dst[row] = _ElemDst(src[((row0 + row) * cols) + col]);
+                    for (size_t row = height; row < c_panel_height; row++)
+                        dst[row] = _ElemDst(0);
+                }
+            }
+        }
+
+        // PackRightOperand() for a source whose element (row, col) is src[row * row_stride + col * col_stride]
+        template<typename _ElemSrc, typename _ElemDst>
+        inline void PackRightOperandStrided(const _ElemSrc* src, const ptrdiff_t row_stride, const ptrdiff_t col_stride, const size_t rows, const size_t cols, _ElemDst* dst)
+        {
+            for (size_t col0 = 0; col0 < cols; col0 += c_panel_width)
+            {
+                const size_t width = std::min(c_panel_width, cols - col0);
+
+                for (size_t row = 0; row < rows; row++, dst += c_panel_width)
+                {
+                    const _ElemSrc* src_row = src + (ptrdiff_t(row) * row_stride) + (ptrdiff_t(col0) * col_stride);
+                    for (size_t col = 0; col < width; col++)
+                        dst[col] = _ElemDst(src_row[ptrdiff_t(col) * col_stride]);
+                    for (size_t col = width; col < c_panel_width; col++)
+                        dst[col] = _ElemDst(0);
+                }
+            }
+        }
+
+        // C[_Height x width] = A[_Height x depth] * panel, the panel must come from PackRightOperand()
+        template<size_t _Height, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void MulPanelRight(const _ElemA* a, const size_t lda, const _ElemB* panel, const size_t depth, _ElemC* c, const size_t ldc, const size_t width)
+        {
+            _ElemC acc[_Height][c_panel_width] = {};
+
+            for (size_t k = 0; k < depth; k++, a++, panel += c_panel_width)
+                for (size_t row = 0; row < _Height; row++)
+                {
+                    const auto a_rk = a[row * lda];
+                    for (size_t col = 0; col < c_panel_width; col++)
+                        acc[row][col] += _ElemC(a_rk * panel[col]);
+                }
+
+            for (size_t row = 0; row < _Height; row++)
+                for (size_t col = 0; col < width; col++)
+                    c[(row * ldc) + col] = acc[row][col];
+        }
+
+        // C[height x width] = panel * B[depth x width], the panel must come from PackLeftOperand()
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void MulPanelLeft(const _ElemA* panel, const size_t depth, const _ElemB* b, const size_t ldb, _ElemC* c, const size_t ldc, const size_t height, const size_t width)
+        {
+            _ElemC acc[c_panel_height][c_panel_width] = {};
+
+            // full panels get a loop with constant bounds, so the compiler can keep [acc] in registers
+            if (width == c_panel_width)
+            {
+                for (size_t k = 0; k < depth; k++, panel += c_panel_height, b += ldb)
+                    for (size_t row = 0; row < c_panel_height; row++)
+                        for (size_t col = 0; col < c_panel_width; col++)
+                            acc[row][col] += _ElemC(panel[row] * b[col]);
+            }
+            else
+            {
+                for (size_t k = 0; k < depth; k++, panel += c_panel_height, b += ldb)
+                    for (size_t row = 0; row < c_panel_height; row++)
+                        for (size_t col = 0; col < width; col++)
+                            acc[row][col] += _ElemC(panel[row] * b[col]);
+            }
+
+            for (size_t row = 0; row < height; row++)
+                for (size_t col = 0; col < width; col++)
+                    c[(row * ldc) + col] = acc[row][col];
+        }
+
+        // C[rows x cols] = A[rows x depth] * B[depth x cols], with B packed by PackRightOperand()
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void MulPackedRight(const _ElemA* a, const _ElemB* packed, _ElemC* c, const size_t rows, const size_t depth, const size_t cols)
+        {
+            for (size_t col0 = 0; col0 < cols; col0 += c_panel_width, packed += (depth * c_panel_width))
+            {
+                const size_t width = std::min(c_panel_width, cols - col0);
+
+                for (size_t row = 0; row < rows;)
+                {
+                    if ((rows - row) >= c_panel_height)
+                    {
+                        MulPanelRight<c_panel_height>(a + (row * depth), depth, packed, depth, c + (row * cols) + col0, cols, width);
+                        row += c_panel_height;
+                    }
+                    else
+                    {
+                        MulPanelRight<1>(a + (row * depth), depth, packed, depth, c + (row * cols) + col0, cols, width);
+                        row++;
+                    }
+                }
+            }
+        }
+
+        // C[rows x cols] = A[rows x depth] * B[depth x cols], with A packed by PackLeftOperand()
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void MulPackedLeft(const _ElemA* packed, const _ElemB* b, _ElemC* c, const size_t rows, const size_t depth, const size_t cols)
+        {
+            for (size_t row0 = 0; row0 < rows; row0 += c_panel_height, packed += (depth * c_panel_height))
+            {
+                const size_t height = std::min(c_panel_height, rows - row0);
+
+                for (size_t col0 = 0; col0 < cols; col0 += c_panel_width)
+                    MulPanelLeft(packed, depth, b + col0, cols, c + (row0 * cols) + col0, cols, height, std::min(c_panel_width, cols - col0));
+            }
+        }
+
+        // Packs the [width] rows of A starting at [src] as one panel of A^T. The panel has the same layout 
+        // as a panel of PackRightOperand(), so A * A^T can be calculated without creating A^T.
+        template<typename _ElemSrc, typename _ElemDst>
+        inline void PackPanelTransposed(const _ElemSrc* src, const size_t width, const size_t depth, _ElemDst* dst)
+        {
+            for (size_t k = 0; k < depth; k++, dst += c_panel_width)
+            {
+                for (size_t col = 0; col < width; col++)
+                    dst[col] = _ElemDst(src[(col * depth) + k]);
+                for (size_t col = width; col < c_panel_width; col++)
+                    dst[col] = _ElemDst(0);
+            }
+        }
+
+        // Copies one triangle of the square matrix [c] into the other one, block by block
+        template<typename _Elem>
+        inline void MirrorTriangle(_Elem* c, const size_t n, const Triangle source)
+        {
+            constexpr size_t c_block = 32;
+
+            for (size_t row0 = 0; row0 < n; row0 += c_block)
+                for (size_t col0 = 0; col0 <= row0; col0 += c_block)
+                    for (size_t row = row0; row < std::min(row0 + c_block, n); row++)
+                        for (size_t col = col0; col < std::min(col0 + c_block, row); col++)
+                        {
+                            if (source == Triangle::Lower) c[(col * n) + row] = c[(row * n) + col];
+                            else c[(row * n) + col] = c[(col * n) + row];
+                        }
+        }
+
+        // Writes alpha * tile + beta * C into the [triangle] of C for a tile of the lower triangle,
+        // which starts at (row0, col0). The upper triangle receives the tile transposed.
+        template<typename _ElemTile, typename _ElemC, typename _ElemAlpha, typename _ElemBeta>
+        inline void StoreSyrkTile(const _ElemTile* tile, const size_t height, const size_t width, _ElemC* c, const size_t n, const size_t row0, const size_t col0, 
+            const _ElemAlpha alpha, const _ElemBeta beta, const Triangle triangle)
+        {
+            for (size_t row = 0; row < height; row++)
+                for (size_t col = 0; col < width && (col0 + col) <= (row0 + row); col++)
+                {
+                    auto& dst = (triangle == Triangle::Lower) ? c[((row0 + row) * n) + col0 + col] : c[((col0 + col) * n) + row0 + row];
+                    const auto value = alpha * tile[(row * c_panel_width) + col];
+                    dst = (beta == _ElemBeta(0)) ? _ElemC(value) : _ElemC(value + (beta * dst));
+                }
+        }
+
+        // C = alpha * A[n x depth] * A^T + beta * C, only the lower triangle is calculated. Panels of
+        // A^T are packed one at a time and only multiplied with the rows of A below the diagonal.
+        template<typename _ElemA, typename _ElemC, typename _ElemAlpha, typename _ElemBeta>
+        inline void Syrk(const _ElemA* a, const size_t n, const size_t depth, _ElemC* c, const _ElemAlpha alpha, const _ElemBeta beta, const Triangle triangle)
+        {
+            std::vector<_ElemA> panel(depth * c_panel_width);
+            _ElemC tile[c_panel_height * c_panel_width];
+
+            for (size_t col0 = 0; col0 < n; col0 += c_panel_width)
+            {
+                const size_t width = std::min(c_panel_width, n - col0);
+                PackPanelTransposed(a + (col0 * depth), width, depth, panel.data());
+
+                for (size_t row = col0; row < n;)
+                {
+                    if ((n - row) >= c_panel_height)
+                    {
+                        MulPanelRight<c_panel_height>(a + (row * depth), depth, panel.data(), depth, tile, c_panel_width, width);
+                        StoreSyrkTile(tile, c_panel_height, width, c, n, row, col0, alpha, beta, triangle);
+                        row += c_panel_height;
+                    }
+                    else
+                    {
+                        MulPanelRight<1>(a + (row * depth), depth, panel.data(), depth, tile, c_panel_width, width);
+                        StoreSyrkTile(tile, 1, width, c, n, row, col0, alpha, beta, triangle);
+                        row++;
+                    }
+                }
+            }
+        }
+
+#ifdef _MATRIX_USE_MULTITHREADING
+        // One worker per additional hardware thread, started on first use and kept alive until the program ends.
+        // Run() hands out part k of a job always to the same worker, so ranges which are split the same way are
+        // processed by the same threads in every pass (first-touch pages stay local on NUMA systems).
+        class WorkerPool
+        {
+        public:
+            static WorkerPool& Instance(void)
+            {
+                static WorkerPool pool;
+                return pool;
+            }
+
+            size_t Threads(void) const { return m_workers.size() + 1; }
+
+            // Calls func(part) for all parts in [0, parts), part 0 on the calling thread. Runs serial when called
+            // from inside a job, e.g. a ParallelFor() in the function of Map(), or if another thread uses the pool.
+            void Run(const size_t parts, const std::function<void(size_t)>& func)
+            {
+                // checked before m_busy, the thread which owns it must not call try_lock() again
+                if (InsideJob() or parts < 2)
+                    return RunSerial(parts, func);
+
+                std::unique_lock<std::mutex> busy(m_busy, std::try_to_lock);
+                if (not busy.owns_lock())
+                    return RunSerial(parts, func);
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    p_job = &func;
+                    m_parts = parts;
+                    m_pending = m_workers.size();
+                    m_generation++;
+                }
+                m_wake.notify_all();
+
+                InsideJob() = true;
+                func(0);
+                for (size_t part = Threads(); part < parts; part++)
+                    func(part);
+                InsideJob() = false;
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done.wait(lock, [this]() { return m_pending == 0; });
+            }
+
+        private:
+            // true while the thread runs a part of a job, the workers never run anything else
+            static bool& InsideJob(void)
+            {
+                static thread_local bool inside = false;
+                return inside;
+            }
+
+            static void RunSerial(const size_t parts, const std::function<void(size_t)>& func)
+            {
+                for (size_t part = 0; part < parts; part++)
+                    func(part);
+            }
+
+            WorkerPool(void)
+            {
+                const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+                for (size_t index = 1; index < hardware; index++)
+                    m_workers.emplace_back([this, index]() { Work(index); });
+            }
+
+            ~WorkerPool(void)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+                m_wake.notify_all();
+
+                for (auto& worker : m_workers)
+                    worker.join();
+            }
+
+            void Work(const size_t index)
+            {
+                InsideJob() = true;
+
+                size_t generation = 0;
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                while (true)
+                {
+                    m_wake.wait(lock, [&]() { return m_stop or m_generation != generation; });
+                    if (m_stop)
+                        return;
+
+                    generation = m_generation;
+                    const std::function<void(size_t)>& job = *p_job;
+                    const size_t parts = m_parts;
+
+                    lock.unlock();
+                    if (index < parts)
+                        job(index);
+                    lock.lock();
+
+                    if (--m_pending == 0)
+                        m_done.notify_one();
+                }
+            }
+
+            std::vector<std::thread> m_workers;
+            std::mutex m_busy;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            const std::function<void(size_t)>* p_job = nullptr;
+            size_t m_parts = 0;
+            size_t m_pending = 0;
+            size_t m_generation = 0;
+            bool m_stop = false;
+        };
+#endif // _MATRIX_USE_MULTITHREADING
+
+        // Splits [0, count) into one contiguous range per thread and calls func(begin, end) for each range.
+        // Runs serial if [_MATRIX_USE_MULTITHREADING] isn't defined or if a thread would get less than [grain] items.
+        template<typename _Func>
+        inline void ParallelFor(const size_t count, const size_t grain, _Func&& func)
+        {
+#ifdef _MATRIX_USE_MULTITHREADING
+            WorkerPool& pool = WorkerPool::Instance();
+            const size_t threads = std::min(pool.Threads(), count / std::max<size_t>(grain, 1));
+
+            if (threads > 1)
+            {
+                const size_t chunk = (count + threads - 1) / threads;
+                pool.Run(threads, [&func, chunk, count](const size_t part)
+                    {
+                        const size_t begin = part * chunk;
+                        if (begin < count)
+                            func(begin, std::min(begin + chunk, count));
+                    });
+                return;
+            }
+#else
+            (void)grain;
+#endif // _MATRIX_USE_MULTITHREADING
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const Matrix2D& _initilizer) :
-    p_mat(new _Elem[_Rows * _Cols])
-{
-    memcpy(p_mat, _initilizer.p_mat, _Cols * _Rows * sizeof(_Elem));
-}
+            func(size_t(0), count);
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemB>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(Matrix2D<_ElemB, _Rows, _Cols>& _initilizer) :
-    p_mat(new _Elem[_Rows * _Cols])
-{
-    for (size_t i = 0; i < _Cols * _Rows; i++)
-        p_mat[i] = _Elem(_initilizer[i]);
-}
+        // The number of elements from which ParallelElements() uses the worker pool, shared by all translation units
+        inline size_t& ParallelThreshold(void)
+        {
+            static size_t threshold = _MATRIX_PARALLEL_THRESHOLD;
+            return threshold;
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const std::initializer_list<std::initializer_list<_Elem>> lists) :
-    p_mat(new _Elem[_Rows * _Cols])
-{
-    size_t i = 0;
-    for (const auto list : lists)
-        for (const auto element : list)
+        // The mode set with SetStreamingStores(), shared by all translation units
+        inline StreamingStores& StreamingStoresMode(void)
         {
-            if (i < c_elements) p_mat[i++] = element;
-            else i++;
+            static StreamingStores mode = StreamingStores::Auto;
+            return mode;
         }
 
-    if (i != c_elements) std::cout << "ERROR! Initializing matrix with " << i << " elements, " << c_elements << " expected!" << std::endl;
-    if (i < c_elements) memset(p_mat + i, 0, (c_elements - i) * sizeof(_Elem));
-}
+        // Whether an output of [bytes] is written with non-temporal stores
+        inline bool UseStreamingStores(const size_t bytes)
+        {
+#ifdef _MATRIX_SIMD
+            switch (StreamingStoresMode())
+            {
+            case StreamingStores::Always:
+                return true;
+            case StreamingStores::Never:
+                return false;
+            default:
+                return bytes >= _MATRIX_STREAMING_THRESHOLD;
+            }
+#else
+            (void)bytes;
+            return false;
+#endif // _MATRIX_SIMD
+        }
+
+        // The size of the ranges ParallelElements() splits [count] elements of _Elem into, [count] if it runs serial
+        template<typename _Elem>
+        inline size_t ParallelChunk(const size_t count)
+        {
+#ifdef _MATRIX_USE_MULTITHREADING
+            if (count >= std::max<size_t>(ParallelThreshold(), 1))
+            {
+                constexpr size_t c_page = std::max<size_t>(4096 / sizeof(_Elem), 1);
+                const size_t threads = WorkerPool::Instance().Threads();
+                return ((count + (threads * c_page) - 1) / (threads * c_page)) * c_page;
+            }
+#endif // _MATRIX_USE_MULTITHREADING
+
+            return std::max<size_t>(count, 1);
+        }
+
+        // Calls func(begin, end) for the elements [0, count) of an array of _Elem. Below ParallelThreshold() the
+        // whole range is processed on the calling thread, above it every thread gets one range. The ranges only
+        // depend on [count] and start on a 4 KiB boundary (relative to the array), so repeated passes over the
+        // same matrix touch the same pages from the same threads.
+        template<typename _Elem, typename _Func>
+        inline void ParallelElements(const size_t count, _Func&& func)
+        {
+#ifdef _MATRIX_USE_MULTITHREADING
+            const size_t chunk = ParallelChunk<_Elem>(count);
+            const size_t parts = (count + chunk - 1) / chunk;
+
+            if (parts > 1)
+            {
+                WorkerPool::Instance().Run(parts, [&func, chunk, count](const size_t part)
+                    {
+                        const size_t begin = part * chunk;
+                        func(begin, std::min(begin + chunk, count));
+                    });
+                return;
+            }
+#endif // _MATRIX_USE_MULTITHREADING
+
+            func(size_t(0), count);
+        }
+
+        // Reduces the ranges of ParallelElements() with func(begin, end) and combines the partial results in the
+        // order of the ranges, so the result doesn't depend on the timing of the threads.
+        template<typename _Elem, typename _Result, typename _Func, typename _Combine>
+        inline _Result ParallelReduce(const size_t count, _Func&& func, _Combine&& combine)
+        {
+#ifdef _MATRIX_USE_MULTITHREADING
+            const size_t chunk = ParallelChunk<_Elem>(count);
+            const size_t parts = (count + chunk - 1) / chunk;
+
+            if (parts > 1)
+            {
+                // the struct keeps std::vector<bool> from packing the results of different threads into one word
+                struct Partial { _Result value; };
+                std::vector<Partial> partial(parts);
+                WorkerPool::Instance().Run(parts, [&func, &partial, chunk, count](const size_t part)
+                    {
+                        const size_t begin = part * chunk;
+                        partial[part].value = func(begin, std::min(begin + chunk, count));
+                    });
+
+                _Result result = partial[0].value;
+                for (size_t part = 1; part < parts; part++)
+                    result = combine(result, partial[part].value);
+                return result;
+            }
+#else
+            (void)combine;
+#endif // _MATRIX_USE_MULTITHREADING
+
+            return func(size_t(0), count);
+        }
+
+        // number of right hand side columns TriMul() and TriSolve() process together, so the
+        // active part of each row stays in cache
+        constexpr size_t c_tri_block = 256;
+
+        // C = T * B for the columns [col0, col1). Lower triangles are processed from the bottom up and
+        // upper triangles from the top down, so each row of B is read before it is overwritten in C.
+        template<Triangle _Triangle, Diagonal _Diagonal, typename _ElemT, typename _ElemB, typename _ElemC>
+        inline void TriMulLeft(const _ElemT* t, const _ElemB* b, _ElemC* c, const size_t n, const size_t cols, const size_t col0, const size_t col1)
+        {
+            std::vector<_ElemC> tmp(c_tri_block);
+
+            for (size_t block0 = col0; block0 < col1; block0 += c_tri_block)
+            {
+                const size_t width = std::min(c_tri_block, col1 - block0);
+
+                for (size_t step = 0; step < n; step++)
+                {
+                    const size_t row = (_Triangle == Triangle::Lower) ? (n - 1 - step) : step;
+                    const size_t k0 = (_Triangle == Triangle::Lower) ? 0 : (row + 1);
+                    const size_t k1 = (_Triangle == Triangle::Lower) ? row : n;
+                    const _ElemB* b_row = b + (row * cols) + block0;
+
+                    if (_Diagonal == Diagonal::Unit)
+                        for (size_t col = 0; col < width; col++)
+                            tmp[col] = _ElemC(b_row[col]);
+                    else
+                        for (size_t col = 0; col < width; col++)
+                            tmp[col] = _ElemC(t[(row * n) + row] * b_row[col]);
+
+                    for (size_t k = k0; k < k1; k++)
+                    {
+                        const auto t_rk = t[(row * n) + k];
+                        const _ElemB* b_k = b + (k * cols) + block0;
+                        for (size_t col = 0; col < width; col++)
+                            tmp[col] += _ElemC(t_rk * b_k[col]);
+                    }
+
+                    memcpy(c + (row * cols) + block0, tmp.data(), width * sizeof(_ElemC));
+                }
+            }
+        }
+
+        // C = B * T for the rows [row0, row1), every row is accumulated from whole rows of T
+        template<Triangle _Triangle, Diagonal _Diagonal, typename _ElemT, typename _ElemB, typename _ElemC>
+        inline void TriMulRight(const _ElemT* t, const _ElemB* b, _ElemC* c, const size_t n, const size_t row0, const size_t row1)
+        {
+            std::vector<_ElemC> tmp(n);
+
+            for (size_t row = row0; row < row1; row++)
+            {
+                const _ElemB* b_row = b + (row * n);
+                std::fill(tmp.begin(), tmp.end(), _ElemC(0));
+
+                for (size_t k = 0; k < n; k++)
+                {
+                    const auto b_k = b_row[k];
+                    const _ElemT* t_k = t + (k * n);
+                    const size_t j0 = (_Triangle == Triangle::Lower) ? 0 : (k + 1);
+                    const size_t j1 = (_Triangle == Triangle::Lower) ? k : n;
+
+                    for (size_t j = j0; j < j1; j++)
+                        tmp[j] += _ElemC(b_k * t_k[j]);
+
+                    if (_Diagonal == Diagonal::Unit) tmp[k] += _ElemC(b_k);
+                    else tmp[k] += _ElemC(b_k * t_k[k]);
+                }
+
+                memcpy(c + (row * n), tmp.data(), n * sizeof(_ElemC));
+            }
+        }
 
-#undef _MATRIX_P_MAT_ASSIGNMENT
+        // Solves T * X = C in place for the columns [col0, col1) by forward (lower) or back (upper) substitution
+        template<Triangle _Triangle, Diagonal _Diagonal, typename _ElemT, typename _ElemC>
+        inline void TriSolveLeft(const _ElemT* t, _ElemC* c, const size_t n, const size_t cols, const size_t col0, const size_t col1)
+        {
+            for (size_t block0 = col0; block0 < col1; block0 += c_tri_block)
+            {
+                const size_t width = std::min(c_tri_block, col1 - block0);
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(_Elem* ptr) :
-    p_mat(ptr)
-{}
+                for (size_t step = 0; step < n; step++)
+                {
+                    const size_t row = (_Triangle == Triangle::Lower) ? step : (n - 1 - step);
+                    const size_t k0 = (_Triangle == Triangle::Lower) ? 0 : (row + 1);
+                    const size_t k1 = (_Triangle == Triangle::Lower) ? row : n;
+                    _ElemC* c_row = c + (row * cols) + block0;
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-Matrix::Matrix2D<_Elem, _Rows, _Cols>::~Matrix2D(void)
-{
-    delete[] p_mat;
-}
+                    for (size_t k = k0; k < k1; k++)
+                    {
+                        const auto t_rk = t[(row * n) + k];
+                        const _ElemC* c_k = c + (k * cols) + block0;
+                        for (size_t col = 0; col < width; col++)
+                            c_row[col] -= _ElemC(t_rk * c_k[col]);
+                    }
+
+                    if (_Diagonal == Diagonal::NonUnit)
+                    {
+                        const auto t_rr = t[(row * n) + row];
+                        for (size_t col = 0; col < width; col++)
+                            c_row[col] = _ElemC(c_row[col] / t_rr);
+                    }
+                }
+            }
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _Cast>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::cout(void)
-{
-    // calculate the longest element per [_Cols] (column)
-    // generate a string with all elements, separated by a space [' ']
-    std::stringstream ss;
-    for (size_t i = 0; i < (_Cols * _Rows); i++)
-        ss << _Cast(p_mat[i]) << ' ';
-    std::istream_iterator<std::string> begin(ss);
-    std::istream_iterator<std::string> end;
-    std::vector <std::string> mat_vals(begin, end);
+        // Solves X * T = C in place for the rows [row0, row1). Each solved element is removed from 
+        // the rest of its row with one row of T, so T is only read sequentially.
+        template<Triangle _Triangle, Diagonal _Diagonal, typename _ElemT, typename _ElemC>
+        inline void TriSolveRight(const _ElemT* t, _ElemC* c, const size_t n, const size_t row0, const size_t row1)
+        {
+            for (size_t row = row0; row < row1; row++)
+            {
+                _ElemC* c_row = c + (row * n);
 
-    // find out the longest string per [_Cols] 
-    size_t max_length[_Cols] = { 0 };
-    for (size_t row = 0; row < _Rows; row++)
-        for (size_t column = 0; column < _Cols; column++)
-            max_length[column] = std::max(max_length[column], mat_vals[POS_XY(row, column)].size());
+                for (size_t step = 0; step < n; step++)
+                {
+                    const size_t k = (_Triangle == Triangle::Lower) ? (n - 1 - step) : step;
+                    const _ElemT* t_k = t + (k * n);
+                    const size_t j0 = (_Triangle == Triangle::Lower) ? 0 : (k + 1);
+                    const size_t j1 = (_Triangle == Triangle::Lower) ? k : n;
 
+                    if (_Diagonal == Diagonal::NonUnit) c_row[k] = _ElemC(c_row[k] / t_k[k]);
 
-    // increase all by one to add 1 space of padding
-    for (auto& element : max_length)
-        element += 1;
+                    const auto x_k = c_row[k];
+                    for (size_t j = j0; j < j1; j++)
+                        c_row[j] -= _ElemC(x_k * t_k[j]);
+                }
+            }
+        }
 
-    // print each element with the needed padding corresponding to the longest
-    // element in the same [_Cols]
-    for (size_t i = 0; i < (_Cols * _Rows); i++)
-    {
-        if ((i % _Cols) == 0) std::cout << '|';
-        std::cout << std::setw(max_length[i % _Cols]) << _Cast(p_mat[i]);
-        if ((i % _Cols) == _Cols - 1) std::cout << ' ' << '|' << std::endl;
+        // C[rows x cols] = A[rows x depth] * B[depth x cols] on plain buffers, B is packed on the fly
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void Gemm(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t rows, const size_t depth, const size_t cols)
+        {
+            std::vector<_ElemB> packed(((cols + c_panel_width - 1) / c_panel_width) * c_panel_width * depth);
+            PackRightOperand(b, depth, cols, packed.data());
+            MulPackedRight(a, packed.data(), c, rows, depth, cols);
+        }
+
+        // Writes the rows [row0, row1) of A (x) B. Each row of the result is a sequence of rows
+        // of B scaled by the elements of one row of A, so C is written strictly sequential.
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void KronRows(const _ElemA* a, const size_t cols_a, const _ElemB* b, const size_t rows_b, const size_t cols_b, _ElemC* c, const size_t row0, const size_t row1)
+        {
+            c += row0 * (cols_a * cols_b);
+
+            for (size_t row = row0; row < row1; row++)
+            {
+                const _ElemA* a_row = a + ((row / rows_b) * cols_a);
+                const _ElemB* b_row = b + ((row % rows_b) * cols_b);
+
+                for (size_t col_a = 0; col_a < cols_a; col_a++, c += cols_b)
+                {
+                    const auto a_ij = a_row[col_a];
+                    for (size_t col = 0; col < cols_b; col++)
+                        c[col] = _ElemC(a_ij * b_row[col]);
+                }
+            }
+        }
+
+        template<typename _Matrix>
+        struct MatrixShape;
+
+        template<typename _Elem, size_t _Rows, size_t _Cols>
+        struct MatrixShape<Matrix2D<_Elem, _Rows, _Cols>>
+        {
+            const static size_t c_rows = _Rows;
+            const static size_t c_cols = _Cols;
+        };
+
+        constexpr size_t Sum(void) { return 0; }
+
+        template<typename... _Values>
+        constexpr size_t Sum(const size_t first, const _Values... rest) { return first + Sum(rest...); }
+
+        // whether all values are equal to [value]
+        constexpr bool AllEqual(const size_t) { return true; }
+
+        template<typename... _Values>
+        constexpr bool AllEqual(const size_t value, const size_t first, const _Values... rest) { return value == first and AllEqual(value, rest...); }
+
+        // Writes the rows of C which belong to [block] and moves (row0, col0) to the next diagonal block
+        template<typename _ElemC, typename _ElemB, size_t _RowsB, size_t _ColsB>
+        inline void WriteDiagonalBlock(_ElemC* c, const size_t cols_c, Matrix2D<_ElemB, _RowsB, _ColsB>& block, size_t& row0, size_t& col0)
+        {
+            for (size_t row = 0; row < _RowsB; row++)
+            {
+                _ElemC* c_row = c + ((row0 + row) * cols_c);
+                const _ElemB* b_row = &block[row * _ColsB];
+
+                std::fill(c_row, c_row + col0, _ElemC(0));
+                for (size_t col = 0; col < _ColsB; col++)
+                    c_row[col0 + col] = _ElemC(b_row[col]);
+                std::fill(c_row + col0 + _ColsB, c_row + cols_c, _ElemC(0));
+            }
+
+            row0 += _RowsB;
+            col0 += _ColsB;
+        }
+
+        // Splits [count] interleaved complex numbers into a real and an imaginary plane
+        template<typename _Elem>
+        inline void Deinterleave(const std::complex<_Elem>* src, _Elem* real, _Elem* imag, const size_t count)
+        {
+            // std::complex<T> is guaranteed to have the layout T[2]
+            const _Elem* p = reinterpret_cast<const _Elem*>(src);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                real[i] = p[2 * i];
+                imag[i] = p[(2 * i) + 1];
+            }
+        }
+
+        // Merges a real and an imaginary plane into [count] interleaved complex numbers
+        template<typename _Elem>
+        inline void Interleave(const _Elem* real, const _Elem* imag, std::complex<_Elem>* dst, const size_t count)
+        {
+            _Elem* p = reinterpret_cast<_Elem*>(dst);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                p[2 * i] = real[i];
+                p[(2 * i) + 1] = imag[i];
+            }
+        }
+
+        // C = A * B for complex matrices in split layout. Each plane of B is packed once and
+        // used for two real multiplications.
+        template<typename _Elem>
+        inline void GemmSplitComplex(const _Elem* a_re, const _Elem* a_im, const _Elem* b_re, const _Elem* b_im, _Elem* c_re, _Elem* c_im,
+            const size_t rows, const size_t depth, const size_t cols, const ComplexMethod method)
+        {
+            const size_t packed_size = ((cols + c_panel_width - 1) / c_panel_width) * c_panel_width * depth;
+            std::vector<_Elem> packed_re(packed_size), packed_im(packed_size), tmp(rows * cols);
+
+            PackRightOperand(b_re, depth, cols, packed_re.data());
+            PackRightOperand(b_im, depth, cols, packed_im.data());
+
+            if (method == ComplexMethod::FourM)
+            {
+                MulPackedRight(a_re, packed_re.data(), c_re, rows, depth, cols);
+                MulPackedRight(a_im, packed_im.data(), tmp.data(), rows, depth, cols);
+                for (size_t i = 0; i < rows * cols; i++)
+                    c_re[i] -= tmp[i];
+
+                MulPackedRight(a_re, packed_im.data(), c_im, rows, depth, cols);
+                MulPackedRight(a_im, packed_re.data(), tmp.data(), rows, depth, cols);
+                for (size_t i = 0; i < rows * cols; i++)
+                    c_im[i] += tmp[i];
+            }
+            else
+            {
+                // (Ar + Ai) and (Br + Bi) get their own buffers, Bi - Br + Br isn't exact and would lose AiBi
+                std::vector<_Elem> a_sum(rows * depth), packed_sum(packed_size);
+                for (size_t i = 0; i < rows * depth; i++)
+                    a_sum[i] = a_re[i] + a_im[i];
+                for (size_t i = 0; i < packed_size; i++)
+                    packed_sum[i] = packed_re[i] + packed_im[i];
+
+                MulPackedRight(a_re, packed_re.data(), c_re, rows, depth, cols);
+                MulPackedRight(a_sum.data(), packed_sum.data(), c_im, rows, depth, cols);
+                MulPackedRight(a_im, packed_im.data(), tmp.data(), rows, depth, cols);
+
+                for (size_t i = 0; i < rows * cols; i++)
+                {
+                    c_im[i] -= c_re[i] + tmp[i];
+                    c_re[i] -= tmp[i];
+                }
+            }
+        }
+
+        // C = A * B for small complex matrices. The real and imaginary parts are calculated directly,
+        // which avoids the NaN handling of std::complex<T>::operator * and vectorizes.
+        template<typename _Elem>
+        inline void GemmComplexDirect(const std::complex<_Elem>* a, const std::complex<_Elem>* b, std::complex<_Elem>* c, const size_t rows, const size_t depth, const size_t cols)
+        {
+            const _Elem* pa = reinterpret_cast<const _Elem*>(a);
+            const _Elem* pb = reinterpret_cast<const _Elem*>(b);
+            _Elem* pc = reinterpret_cast<_Elem*>(c);
+
+            for (size_t row = 0; row < rows; row++)
+                for (size_t col = 0; col < cols; col++)
+                {
+                    _Elem re = 0, im = 0;
+                    for (size_t k = 0; k < depth; k++)
+                    {
+                        const _Elem a_re = pa[2 * ((row * depth) + k)], a_im = pa[(2 * ((row * depth) + k)) + 1];
+                        const _Elem b_re = pb[2 * ((k * cols) + col)], b_im = pb[(2 * ((k * cols) + col)) + 1];
+                        re += (a_re * b_re) - (a_im * b_im);
+                        im += (a_re * b_im) + (a_im * b_re);
+                    }
+                    pc[2 * ((row * cols) + col)] = re;
+                    pc[(2 * ((row * cols) + col)) + 1] = im;
+                }
+        }
+
+#ifdef _MATRIX_SIMD
+        // One SIMD register of floats or doubles. The kernels are written once against these
+        // wrappers and compiled for AVX2 or SSE2, depending on the target.
+#ifdef _MATRIX_SIMD_AVX2
+        typedef __m256 SimdFloat;
+        typedef __m256d SimdDouble;
+        constexpr size_t c_simd_floats = 8;
+        constexpr size_t c_simd_doubles = 4;
+
+        inline SimdFloat SimdAdd(const SimdFloat a, const SimdFloat b) { return _mm256_add_ps(a, b); }
+        inline SimdFloat SimdSub(const SimdFloat a, const SimdFloat b) { return _mm256_sub_ps(a, b); }
+        inline SimdFloat SimdMul(const SimdFloat a, const SimdFloat b) { return _mm256_mul_ps(a, b); }
+        inline SimdFloat SimdDiv(const SimdFloat a, const SimdFloat b) { return _mm256_div_ps(a, b); }
+        inline SimdDouble SimdAdd(const SimdDouble a, const SimdDouble b) { return _mm256_add_pd(a, b); }
+        inline SimdDouble SimdSub(const SimdDouble a, const SimdDouble b) { return _mm256_sub_pd(a, b); }
+        inline SimdDouble SimdMul(const SimdDouble a, const SimdDouble b) { return _mm256_mul_pd(a, b); }
+        inline SimdDouble SimdDiv(const SimdDouble a, const SimdDouble b) { return _mm256_div_pd(a, b); }
+#else
+        typedef __m128 SimdFloat;
+        typedef __m128d SimdDouble;
+        constexpr size_t c_simd_floats = 4;
+        constexpr size_t c_simd_doubles = 2;
+
+        inline SimdFloat SimdAdd(const SimdFloat a, const SimdFloat b) { return _mm_add_ps(a, b); }
+        inline SimdFloat SimdSub(const SimdFloat a, const SimdFloat b) { return _mm_sub_ps(a, b); }
+        inline SimdFloat SimdMul(const SimdFloat a, const SimdFloat b) { return _mm_mul_ps(a, b); }
+        inline SimdFloat SimdDiv(const SimdFloat a, const SimdFloat b) { return _mm_div_ps(a, b); }
+        inline SimdDouble SimdAdd(const SimdDouble a, const SimdDouble b) { return _mm_add_pd(a, b); }
+        inline SimdDouble SimdSub(const SimdDouble a, const SimdDouble b) { return _mm_sub_pd(a, b); }
+        inline SimdDouble SimdMul(const SimdDouble a, const SimdDouble b) { return _mm_mul_pd(a, b); }
+        inline SimdDouble SimdDiv(const SimdDouble a, const SimdDouble b) { return _mm_div_pd(a, b); }
+#endif // _MATRIX_SIMD_AVX2
+
+        // Loads one register of floats or doubles from an array of _Elem, converting on the fly
+        template<typename _Elem>
+        struct SimdLoad
+        {
+            const static bool c_to_float = false;
+            const static bool c_to_double = false;
+        };
+
+        template<>
+        struct SimdLoad<float>
+        {
+            const static bool c_to_float = true;
+            const static bool c_to_double = true;
+#ifdef _MATRIX_SIMD_AVX2
+            static SimdFloat Float(const float* p) { return _mm256_loadu_ps(p); }
+            static SimdDouble Double(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+#else
+            static SimdFloat Float(const float* p) { return _mm_loadu_ps(p); }
+            static SimdDouble Double(const float* p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)p))); }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        template<>
+        struct SimdLoad<double>
+        {
+            const static bool c_to_float = false;
+            const static bool c_to_double = true;
+#ifdef _MATRIX_SIMD_AVX2
+            static SimdDouble Double(const double* p) { return _mm256_loadu_pd(p); }
+#else
+            static SimdDouble Double(const double* p) { return _mm_loadu_pd(p); }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        template<>
+        struct SimdLoad<int32_t>
+        {
+            const static bool c_to_float = true;
+            const static bool c_to_double = true;
+#ifdef _MATRIX_SIMD_AVX2
+            static SimdFloat Float(const int32_t* p) { return _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)p)); }
+            static SimdDouble Double(const int32_t* p) { return _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)p)); }
+#else
+            static SimdFloat Float(const int32_t* p) { return _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)p)); }
+            static SimdDouble Double(const int32_t* p) { return _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*)p)); }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        template<>
+        struct SimdLoad<uint8_t>
+        {
+            const static bool c_to_float = true;
+            const static bool c_to_double = true;
+#ifdef _MATRIX_SIMD_AVX2
+            static SimdFloat Float(const uint8_t* p) { return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p))); }
+            static SimdDouble Double(const uint8_t* p)
+            {
+                int32_t bytes;
+                memcpy(&bytes, p, sizeof(bytes));
+                return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)));
+            }
+#else
+            static __m128i Widen(const int32_t bytes)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+            }
+            static SimdFloat Float(const uint8_t* p)
+            {
+                int32_t bytes;
+                memcpy(&bytes, p, sizeof(bytes));
+                return _mm_cvtepi32_ps(Widen(bytes));
+            }
+            static SimdDouble Double(const uint8_t* p)
+            {
+                uint16_t bytes;
+                memcpy(&bytes, p, sizeof(bytes));
+                return _mm_cvtepi32_pd(Widen(bytes));
+            }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        // Stores one register of floats or doubles into an array of _Elem
+        template<typename _Elem>
+        struct SimdStore;
+
+        template<>
+        struct SimdStore<float>
+        {
+#ifdef _MATRIX_SIMD_AVX2
+            static void Float(float* p, const SimdFloat v) { _mm256_storeu_ps(p, v); }
+            static void Double(float* p, const SimdDouble v) { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+#else
+            static void Float(float* p, const SimdFloat v) { _mm_storeu_ps(p, v); }
+            static void Double(float* p, const SimdDouble v) { _mm_storel_epi64((__m128i*)p, _mm_castps_si128(_mm_cvtpd_ps(v))); }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        template<>
+        struct SimdStore<double>
+        {
+#ifdef _MATRIX_SIMD_AVX2
+            static void Double(double* p, const SimdDouble v) { _mm256_storeu_pd(p, v); }
+#else
+            static void Double(double* p, const SimdDouble v) { _mm_storeu_pd(p, v); }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        // Non-temporal stores of one register, [p] must be aligned to the size of a register
+#ifdef _MATRIX_SIMD_AVX2
+        inline void SimdStream(float* p, const SimdFloat v) { _mm256_stream_ps(p, v); }
+        inline void SimdStream(double* p, const SimdDouble v) { _mm256_stream_pd(p, v); }
+        inline void SimdStreamZero(void* p) { _mm256_stream_si256((__m256i*)p, _mm256_setzero_si256()); }
+#else
+        inline void SimdStream(float* p, const SimdFloat v) { _mm_stream_ps(p, v); }
+        inline void SimdStream(double* p, const SimdDouble v) { _mm_stream_pd(p, v); }
+        inline void SimdStreamZero(void* p) { _mm_stream_si128((__m128i*)p, _mm_setzero_si128()); }
+#endif // _MATRIX_SIMD_AVX2
+
+        // Non-temporal stores aren't ordered with other stores, so every thread finishes them with a fence
+        inline void SimdStreamFence(void) { _mm_sfence(); }
+
+        constexpr size_t c_simd_bytes = sizeof(SimdFloat);
+
+        // The number of elements in front of [p] until it is aligned for SimdStream()
+        template<typename _Elem>
+        inline size_t SimdStreamPeel(const _Elem* p)
+        {
+            return ((c_simd_bytes - (uintptr_t(p) % c_simd_bytes)) % c_simd_bytes) / sizeof(_Elem);
+        }
+#endif // _MATRIX_SIMD
+
+        // Element-by-element operations, usable on scalars and on SIMD registers
+        struct OpAdd
+        {
+            template<typename _A, typename _B> static auto Apply(const _A a, const _B b) -> decltype(a + b) { return a + b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a, const SimdFloat b) { return SimdAdd(a, b); }
+            static SimdDouble Apply(const SimdDouble a, const SimdDouble b) { return SimdAdd(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct OpSub
+        {
+            template<typename _A, typename _B> static auto Apply(const _A a, const _B b) -> decltype(a - b) { return a - b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a, const SimdFloat b) { return SimdSub(a, b); }
+            static SimdDouble Apply(const SimdDouble a, const SimdDouble b) { return SimdSub(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct OpMul
+        {
+            template<typename _A, typename _B> static auto Apply(const _A a, const _B b) -> decltype(a * b) { return a * b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a, const SimdFloat b) { return SimdMul(a, b); }
+            static SimdDouble Apply(const SimdDouble a, const SimdDouble b) { return SimdMul(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct OpDiv
+        {
+            template<typename _A, typename _B> static auto Apply(const _A a, const _B b) -> decltype(a / b) { return a / b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a, const SimdFloat b) { return SimdDiv(a, b); }
+            static SimdDouble Apply(const SimdDouble a, const SimdDouble b) { return SimdDiv(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        // Selects the SIMD kernel for a combination of types. The calculation has to happen in the same
+        // type the scalar code would use, so the results are identical:
+        // 0 = no SIMD kernel, 1 = calculation in float, 2 = calculation in double
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        struct SimdPath
+        {
+#ifdef _MATRIX_SIMD
+            typedef decltype(std::declval<_ElemA>() + std::declval<_ElemB>()) _Calc;
+
+            const static int c_value =
+                (std::is_same<_Calc, float>::value and std::is_same<_ElemC, float>::value and
+                    SimdLoad<_ElemA>::c_to_float and SimdLoad<_ElemB>::c_to_float) ? 1 :
+                (std::is_same<_Calc, double>::value and (std::is_same<_ElemC, float>::value or std::is_same<_ElemC, double>::value) and
+                    SimdLoad<_ElemA>::c_to_double and SimdLoad<_ElemB>::c_to_double) ? 2 : 0;
+#else
+            const static int c_value = 0;
+#endif // _MATRIX_SIMD
+        };
+
+        // The SIMD part of Elementwise(), returns the number of processed elements
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseSimd(const _ElemA*, const _ElemB*, _ElemC*, const size_t, std::integral_constant<int, 0>)
+        {
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseSimd(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count, std::integral_constant<int, 1>)
+        {
+            const size_t end = count - (count % c_simd_floats);
+            for (size_t i = 0; i < end; i += c_simd_floats)
+                SimdStore<_ElemC>::Float(c + i, _Op::Apply(SimdLoad<_ElemA>::Float(a + i), SimdLoad<_ElemB>::Float(b + i)));
+            return end;
+        }
+
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseSimd(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count, std::integral_constant<int, 2>)
+        {
+            const size_t end = count - (count % c_simd_doubles);
+            for (size_t i = 0; i < end; i += c_simd_doubles)
+                SimdStore<_ElemC>::Double(c + i, _Op::Apply(SimdLoad<_ElemA>::Double(a + i), SimdLoad<_ElemB>::Double(b + i)));
+            return end;
+        }
+#endif // _MATRIX_SIMD
+
+        // Non-temporal stores are only used if the SIMD kernel calculates in the type of C:
+        // 0 = normal stores, 1 = float, 2 = double
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        struct StreamPath
+        {
+            const static int c_path = SimdPath<_ElemA, _ElemB, _ElemC>::c_value;
+            const static int c_value = ((c_path == 1 and std::is_same<_ElemC, float>::value) or
+                (c_path == 2 and std::is_same<_ElemC, double>::value)) ? c_path : 0;
+        };
+
+        // ElementwiseSimd() with non-temporal stores, returns the number of processed elements
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseStream(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count, std::integral_constant<int, 0>)
+        {
+            return ElementwiseSimd<_Op>(a, b, c, count, std::integral_constant<int, SimdPath<_ElemA, _ElemB, _ElemC>::c_value>());
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Op, typename _ElemA, typename _ElemB>
+        inline size_t ElementwiseStream(const _ElemA* a, const _ElemB* b, float* c, const size_t count, std::integral_constant<int, 1>)
+        {
+            size_t i = 0;
+            for (const size_t peel = std::min(SimdStreamPeel(c), count); i < peel; i++)
+                c[i] = float(_Op::Apply(a[i], b[i]));
+
+            for (; i + c_simd_floats <= count; i += c_simd_floats)
+                SimdStream(c + i, _Op::Apply(SimdLoad<_ElemA>::Float(a + i), SimdLoad<_ElemB>::Float(b + i)));
+            SimdStreamFence();
+            return i;
+        }
+
+        template<typename _Op, typename _ElemA, typename _ElemB>
+        inline size_t ElementwiseStream(const _ElemA* a, const _ElemB* b, double* c, const size_t count, std::integral_constant<int, 2>)
+        {
+            size_t i = 0;
+            for (const size_t peel = std::min(SimdStreamPeel(c), count); i < peel; i++)
+                c[i] = double(_Op::Apply(a[i], b[i]));
+
+            for (; i + c_simd_doubles <= count; i += c_simd_doubles)
+                SimdStream(c + i, _Op::Apply(SimdLoad<_ElemA>::Double(a + i), SimdLoad<_ElemB>::Double(b + i)));
+            SimdStreamFence();
+            return i;
+        }
+#endif // _MATRIX_SIMD
+
+        // C[i] = _ElemC(A[i] op B[i]) for [count] elements. Common type combinations are converted and
+        // calculated in SIMD registers, everything else is left to the compiler.
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void ElementwiseRange(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count, const bool stream)
+        {
+            size_t i = stream ?
+                ElementwiseStream<_Op>(a, b, c, count, std::integral_constant<int, StreamPath<_ElemA, _ElemB, _ElemC>::c_value>()) :
+                ElementwiseSimd<_Op>(a, b, c, count, std::integral_constant<int, SimdPath<_ElemA, _ElemB, _ElemC>::c_value>());
+
+            for (; i < count; i++)
+                c[i] = _ElemC(_Op::Apply(a[i], b[i]));
+        }
+
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void Elementwise(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count)
+        {
+            const bool stream = UseStreamingStores(count * sizeof(_ElemC));
+
+            ParallelElements<_ElemC>(count, [=](const size_t begin, const size_t end)
+                {
+                    ElementwiseRange<_Op>(a + begin, b + begin, c + begin, end - begin, stream);
+                });
+        }
+
+        // C = A op B for a [rows] x [cols] matrix A and a row vector B which is applied to every row
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void BroadcastRow(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t rows, const size_t cols)
+        {
+            const bool stream = UseStreamingStores(rows * cols * sizeof(_ElemC));
+
+            ParallelElements<_ElemC>(rows * cols, [=](const size_t begin, const size_t end)
+                {
+                    // the ranges don't start at a row, so the first and last part of a row may be cut off
+                    for (size_t i = begin; i < end;)
+                    {
+                        const size_t col = i % cols;
+                        const size_t count = std::min(cols - col, end - i);
+                        ElementwiseRange<_Op>(a + i, b + col, c + i, count, stream);
+                        i += count;
+                    }
+                });
+        }
+
+        // out[i] = _ElemOut(f(in[i]...)) for the elements [begin, end). The results are collected in blocks of a fixed
+        // size on the stack, so the inlined call of f can be vectorized without knowing whether [out] overlaps the inputs.
+        template<typename _ElemOut, typename _Func, typename... _Elems>
+        inline void ZipRange(_ElemOut* out, const size_t begin, const size_t end, _Func& f, const _Elems*... in)
+        {
+            constexpr size_t c_block = 64;
+            _ElemOut block[c_block];
+
+            const size_t blocks_end = end - ((end - begin) % c_block);
+            size_t i = begin;
+            for (; i < blocks_end; i += c_block)
+            {
+                for (size_t j = 0; j < c_block; j++)
+                    block[j] = _ElemOut(f(in[i + j]...));
+                std::copy(block, block + c_block, out + i);
+            }
+
+            for (; i < end; i++)
+                out[i] = _ElemOut(f(in[i]...));
+        }
+
+        template<typename _ElemOut, typename _Func, typename... _Elems>
+        inline void Zip(_ElemOut* out, const size_t count, _Func& f, const _Elems*... in)
+        {
+            ParallelElements<_ElemOut>(count, [out, &f, in...](const size_t begin, const size_t end)
+                {
+                    ZipRange(out, begin, end, f, in...);
+                });
+        }
+
+        // The accuracy used for Accuracy::Default, shared by all translation units
+        inline Accuracy& DefaultAccuracy(void)
+        {
+            static Accuracy accuracy = Accuracy::_MATRIX_DEFAULT_ACCURACY;
+            return accuracy;
+        }
+
+        inline Accuracy ResolveAccuracy(const Accuracy accuracy)
+        {
+            return (accuracy == Accuracy::Default) ? DefaultAccuracy() : accuracy;
+        }
+
+#ifdef _MATRIX_SIMD
+        // Further operations for the transcendental kernels, which are written once for SimdFloat and SimdDouble
+#ifdef _MATRIX_SIMD_AVX2
+#ifdef __FMA__
+        inline SimdFloat SimdFma(const SimdFloat a, const SimdFloat b, const SimdFloat c) { return _mm256_fmadd_ps(a, b, c); }
+        inline SimdDouble SimdFma(const SimdDouble a, const SimdDouble b, const SimdDouble c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+        inline SimdFloat SimdFma(const SimdFloat a, const SimdFloat b, const SimdFloat c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+        inline SimdDouble SimdFma(const SimdDouble a, const SimdDouble b, const SimdDouble c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif // __FMA__
+        inline SimdFloat SimdSetFloat(const float v) { return _mm256_set1_ps(v); }
+        inline SimdDouble SimdSetDouble(const double v) { return _mm256_set1_pd(v); }
+        inline SimdFloat SimdMin(const SimdFloat a, const SimdFloat b) { return _mm256_min_ps(a, b); }
+        inline SimdFloat SimdMax(const SimdFloat a, const SimdFloat b) { return _mm256_max_ps(a, b); }
+        inline SimdFloat SimdAnd(const SimdFloat a, const SimdFloat b) { return _mm256_and_ps(a, b); }
+        inline SimdFloat SimdOr(const SimdFloat a, const SimdFloat b) { return _mm256_or_ps(a, b); }
+        inline SimdFloat SimdXor(const SimdFloat a, const SimdFloat b) { return _mm256_xor_ps(a, b); }
+        inline SimdFloat SimdAndNot(const SimdFloat a, const SimdFloat b) { return _mm256_andnot_ps(a, b); }
+        inline SimdFloat SimdLess(const SimdFloat a, const SimdFloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        inline SimdFloat SimdEqual(const SimdFloat a, const SimdFloat b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        inline SimdFloat SimdNotGreaterEqual(const SimdFloat a, const SimdFloat b) { return _mm256_cmp_ps(a, b, _CMP_NGE_UQ); }
+        inline SimdFloat SimdSelect(const SimdFloat mask, const SimdFloat a, const SimdFloat b) { return _mm256_blendv_ps(b, a, mask); }
+        inline bool SimdAny(const SimdFloat mask) { return _mm256_movemask_ps(mask) != 0; }
+        inline SimdFloat SimdLessEqual(const SimdFloat a, const SimdFloat b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        inline SimdFloat SimdNotEqual(const SimdFloat a, const SimdFloat b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+        inline uint32_t SimdBits(const SimdFloat mask) { return uint32_t(_mm256_movemask_ps(mask)); }
+        inline SimdFloat SimdMaskFloat(const uint32_t bits)
+        {
+            const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits)), lanes), lanes));
+        }
+        inline SimdFloat SimdRound(const SimdFloat a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+        inline SimdFloat SimdSqrt(const SimdFloat a) { return _mm256_sqrt_ps(a); }
+        inline SimdFloat SimdRsqrtEstimate(const SimdFloat a) { return _mm256_rsqrt_ps(a); }
+
+        inline SimdDouble SimdMin(const SimdDouble a, const SimdDouble b) { return _mm256_min_pd(a, b); }
+        inline SimdDouble SimdMax(const SimdDouble a, const SimdDouble b) { return _mm256_max_pd(a, b); }
+        inline SimdDouble SimdAnd(const SimdDouble a, const SimdDouble b) { return _mm256_and_pd(a, b); }
+        inline SimdDouble SimdOr(const SimdDouble a, const SimdDouble b) { return _mm256_or_pd(a, b); }
+        inline SimdDouble SimdXor(const SimdDouble a, const SimdDouble b) { return _mm256_xor_pd(a, b); }
+        inline SimdDouble SimdAndNot(const SimdDouble a, const SimdDouble b) { return _mm256_andnot_pd(a, b); }
+        inline SimdDouble SimdLess(const SimdDouble a, const SimdDouble b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        inline SimdDouble SimdEqual(const SimdDouble a, const SimdDouble b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        inline SimdDouble SimdNotGreaterEqual(const SimdDouble a, const SimdDouble b) { return _mm256_cmp_pd(a, b, _CMP_NGE_UQ); }
+        inline SimdDouble SimdSelect(const SimdDouble mask, const SimdDouble a, const SimdDouble b) { return _mm256_blendv_pd(b, a, mask); }
+        inline bool SimdAny(const SimdDouble mask) { return _mm256_movemask_pd(mask) != 0; }
+        inline SimdDouble SimdLessEqual(const SimdDouble a, const SimdDouble b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+        inline SimdDouble SimdNotEqual(const SimdDouble a, const SimdDouble b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+        inline uint32_t SimdBits(const SimdDouble mask) { return uint32_t(_mm256_movemask_pd(mask)); }
+        inline SimdDouble SimdMaskDouble(const uint32_t bits)
+        {
+            const __m256i lanes = _mm256_setr_epi64x(1, 2, 4, 8);
+            return _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(int64_t(bits)), lanes), lanes));
+        }
+        inline SimdDouble SimdRound(const SimdDouble a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+        inline SimdDouble SimdSqrt(const SimdDouble a) { return _mm256_sqrt_pd(a); }
+
+        // 2^k for integral k of the normal range: k is added to 2^mantissa_bits + bias, which moves
+        // the biased exponent into the lowest bits, from where it is shifted into the exponent field
+        inline SimdFloat SimdPow2(const SimdFloat k)
+        {
+            return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(_mm256_add_ps(k, _mm256_set1_ps(8388608.0f + 127.0f))), 23));
+        }
+
+        inline SimdDouble SimdPow2(const SimdDouble k)
+        {
+            return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(k, _mm256_set1_pd(4503599627370496.0 + 1023.0))), 52));
+        }
+
+        // The unbiased exponent and the mantissa in [1, 2) of positive normal numbers
+        inline SimdFloat SimdExponent(const SimdFloat x)
+        {
+            const __m256i biased = _mm256_or_si256(_mm256_srli_epi32(_mm256_castps_si256(x), 23), _mm256_set1_epi32(0x4B000000));
+            return _mm256_sub_ps(_mm256_castsi256_ps(biased), _mm256_set1_ps(8388608.0f + 127.0f));
+        }
+
+        inline SimdDouble SimdExponent(const SimdDouble x)
+        {
+            const __m256i biased = _mm256_or_si256(_mm256_srli_epi64(_mm256_castpd_si256(x), 52), _mm256_set1_epi64x(0x4330000000000000LL));
+            return _mm256_sub_pd(_mm256_castsi256_pd(biased), _mm256_set1_pd(4503599627370496.0 + 1023.0));
+        }
+
+        inline SimdFloat SimdMantissa(const SimdFloat x)
+        {
+            const __m256i bits = _mm256_and_si256(_mm256_castps_si256(x), _mm256_set1_epi32(0x007FFFFF));
+            return _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_set1_epi32(0x3F800000)));
+        }
+
+        inline SimdDouble SimdMantissa(const SimdDouble x)
+        {
+            const __m256i bits = _mm256_and_si256(_mm256_castpd_si256(x), _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+            return _mm256_castsi256_pd(_mm256_or_si256(bits, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+        }
+#else
+#ifdef __FMA__
+        inline SimdFloat SimdFma(const SimdFloat a, const SimdFloat b, const SimdFloat c) { return _mm_fmadd_ps(a, b, c); }
+        inline SimdDouble SimdFma(const SimdDouble a, const SimdDouble b, const SimdDouble c) { return _mm_fmadd_pd(a, b, c); }
+#else
+        inline SimdFloat SimdFma(const SimdFloat a, const SimdFloat b, const SimdFloat c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        inline SimdDouble SimdFma(const SimdDouble a, const SimdDouble b, const SimdDouble c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+#endif // __FMA__
+        inline SimdFloat SimdSetFloat(const float v) { return _mm_set1_ps(v); }
+        inline SimdDouble SimdSetDouble(const double v) { return _mm_set1_pd(v); }
+        inline SimdFloat SimdMin(const SimdFloat a, const SimdFloat b) { return _mm_min_ps(a, b); }
+        inline SimdFloat SimdMax(const SimdFloat a, const SimdFloat b) { return _mm_max_ps(a, b); }
+        inline SimdFloat SimdAnd(const SimdFloat a, const SimdFloat b) { return _mm_and_ps(a, b); }
+        inline SimdFloat SimdOr(const SimdFloat a, const SimdFloat b) { return _mm_or_ps(a, b); }
+        inline SimdFloat SimdXor(const SimdFloat a, const SimdFloat b) { return _mm_xor_ps(a, b); }
+        inline SimdFloat SimdAndNot(const SimdFloat a, const SimdFloat b) { return _mm_andnot_ps(a, b); }
+        inline SimdFloat SimdLess(const SimdFloat a, const SimdFloat b) { return _mm_cmplt_ps(a, b); }
+        inline SimdFloat SimdEqual(const SimdFloat a, const SimdFloat b) { return _mm_cmpeq_ps(a, b); }
+        inline SimdFloat SimdNotGreaterEqual(const SimdFloat a, const SimdFloat b) { return _mm_cmpnge_ps(a, b); }
+        inline SimdFloat SimdSelect(const SimdFloat mask, const SimdFloat a, const SimdFloat b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+        inline bool SimdAny(const SimdFloat mask) { return _mm_movemask_ps(mask) != 0; }
+        inline SimdFloat SimdLessEqual(const SimdFloat a, const SimdFloat b) { return _mm_cmple_ps(a, b); }
+        inline SimdFloat SimdNotEqual(const SimdFloat a, const SimdFloat b) { return _mm_cmpneq_ps(a, b); }
+        inline uint32_t SimdBits(const SimdFloat mask) { return uint32_t(_mm_movemask_ps(mask)); }
+        inline SimdFloat SimdMaskFloat(const uint32_t bits)
+        {
+            const __m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+            return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits)), lanes), lanes));
+        }
+        inline SimdFloat SimdSqrt(const SimdFloat a) { return _mm_sqrt_ps(a); }
+        inline SimdFloat SimdRsqrtEstimate(const SimdFloat a) { return _mm_rsqrt_ps(a); }
+
+        // SSE2 has no rounding instruction: adding 2^23 with the sign of a rounds away the fraction,
+        // numbers beyond 2^23 are integral already. The sign is restored for results like -0.
+        inline SimdFloat SimdRound(const SimdFloat a)
+        {
+            const SimdFloat sign = _mm_and_ps(_mm_set1_ps(-0.0f), a);
+            const SimdFloat magic = _mm_or_ps(_mm_set1_ps(8388608.0f), sign);
+            const SimdFloat integral = _mm_cmplt_ps(_mm_set1_ps(8388608.0f), _mm_andnot_ps(_mm_set1_ps(-0.0f), a));
+            return SimdSelect(integral, a, _mm_or_ps(_mm_sub_ps(_mm_add_ps(a, magic), magic), sign));
+        }
+
+        inline SimdDouble SimdMin(const SimdDouble a, const SimdDouble b) { return _mm_min_pd(a, b); }
+        inline SimdDouble SimdMax(const SimdDouble a, const SimdDouble b) { return _mm_max_pd(a, b); }
+        inline SimdDouble SimdAnd(const SimdDouble a, const SimdDouble b) { return _mm_and_pd(a, b); }
+        inline SimdDouble SimdOr(const SimdDouble a, const SimdDouble b) { return _mm_or_pd(a, b); }
+        inline SimdDouble SimdXor(const SimdDouble a, const SimdDouble b) { return _mm_xor_pd(a, b); }
+        inline SimdDouble SimdAndNot(const SimdDouble a, const SimdDouble b) { return _mm_andnot_pd(a, b); }
+        inline SimdDouble SimdLess(const SimdDouble a, const SimdDouble b) { return _mm_cmplt_pd(a, b); }
+        inline SimdDouble SimdEqual(const SimdDouble a, const SimdDouble b) { return _mm_cmpeq_pd(a, b); }
+        inline SimdDouble SimdNotGreaterEqual(const SimdDouble a, const SimdDouble b) { return _mm_cmpnge_pd(a, b); }
+        inline SimdDouble SimdSelect(const SimdDouble mask, const SimdDouble a, const SimdDouble b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+        inline bool SimdAny(const SimdDouble mask) { return _mm_movemask_pd(mask) != 0; }
+        inline SimdDouble SimdLessEqual(const SimdDouble a, const SimdDouble b) { return _mm_cmple_pd(a, b); }
+        inline SimdDouble SimdNotEqual(const SimdDouble a, const SimdDouble b) { return _mm_cmpneq_pd(a, b); }
+        inline uint32_t SimdBits(const SimdDouble mask) { return uint32_t(_mm_movemask_pd(mask)); }
+
+        // SSE2 can't compare 64 bit integers, but both halves of a lane match if the lane is selected
+        inline SimdDouble SimdMaskDouble(const uint32_t bits)
+        {
+            const __m128i lanes = _mm_setr_epi32(1, 1, 2, 2);
+            return _mm_castsi128_pd(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(bits)), lanes), lanes));
+        }
+        inline SimdDouble SimdSqrt(const SimdDouble a) { return _mm_sqrt_pd(a); }
+
+        inline SimdDouble SimdRound(const SimdDouble a)
+        {
+            const SimdDouble sign = _mm_and_pd(_mm_set1_pd(-0.0), a);
+            const SimdDouble magic = _mm_or_pd(_mm_set1_pd(4503599627370496.0), sign);
+            const SimdDouble integral = _mm_cmplt_pd(_mm_set1_pd(4503599627370496.0), _mm_andnot_pd(_mm_set1_pd(-0.0), a));
+            return SimdSelect(integral, a, _mm_or_pd(_mm_sub_pd(_mm_add_pd(a, magic), magic), sign));
+        }
+
+        // 2^k for integral k of the normal range: k is added to 2^mantissa_bits + bias, which moves
+        // the biased exponent into the lowest bits, from where it is shifted into the exponent field
+        inline SimdFloat SimdPow2(const SimdFloat k)
+        {
+            return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm_add_ps(k, _mm_set1_ps(8388608.0f + 127.0f))), 23));
+        }
+
+        inline SimdDouble SimdPow2(const SimdDouble k)
+        {
+            return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(4503599627370496.0 + 1023.0))), 52));
+        }
+
+        // The unbiased exponent and the mantissa in [1, 2) of positive normal numbers
+        inline SimdFloat SimdExponent(const SimdFloat x)
+        {
+            const __m128i biased = _mm_or_si128(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(0x4B000000));
+            return _mm_sub_ps(_mm_castsi128_ps(biased), _mm_set1_ps(8388608.0f + 127.0f));
+        }
+
+        inline SimdDouble SimdExponent(const SimdDouble x)
+        {
+            const __m128i biased = _mm_or_si128(_mm_srli_epi64(_mm_castpd_si128(x), 52), _mm_set1_epi64x(0x4330000000000000LL));
+            return _mm_sub_pd(_mm_castsi128_pd(biased), _mm_set1_pd(4503599627370496.0 + 1023.0));
+        }
+
+        inline SimdFloat SimdMantissa(const SimdFloat x)
+        {
+            const __m128i bits = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x007FFFFF));
+            return _mm_castsi128_ps(_mm_or_si128(bits, _mm_set1_epi32(0x3F800000)));
+        }
+
+        inline SimdDouble SimdMantissa(const SimdDouble x)
+        {
+            const __m128i bits = _mm_and_si128(_mm_castpd_si128(x), _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+            return _mm_castsi128_pd(_mm_or_si128(bits, _mm_set1_epi64x(0x3FF0000000000000LL)));
+        }
+#endif // _MATRIX_SIMD_AVX2
+
+        // Lane type dependent constants and conversions of the kernels, SimdLaneOf() finds them for a register type
+        template<typename _Scalar>
+        struct SimdLane;
+
+        template<>
+        struct SimdLane<float>
+        {
+            typedef SimdFloat _V;
+            const static size_t c_lanes = c_simd_floats;
+            static SimdFloat Set(const double v) { return SimdSetFloat(float(v)); }
+            static SimdFloat Mask(const uint32_t bits) { return SimdMaskFloat(bits); }
+            template<typename _Elem> static SimdFloat Load(const _Elem* p) { return SimdLoad<_Elem>::Float(p); }
+            template<typename _Elem> static void Store(_Elem* p, const SimdFloat v) { SimdStore<_Elem>::Float(p, v); }
+
+            // ln(2) split into a part with few bits, so k * c_ln2_hi is exact, and the rest
+            constexpr static double c_ln2_hi = 0.693359375;
+            constexpr static double c_ln2_lo = -2.12194440e-4;
+            // exp() is 0 below and infinite above this range
+            constexpr static double c_exp_min = -104.0;
+            constexpr static double c_exp_max = 89.0;
+            constexpr static double c_min_normal = 1.17549435e-38;
+            constexpr static double c_subnormal_scale = 8388608.0; // 2^23
+            constexpr static double c_subnormal_exponent = 23.0;
+        };
+
+        template<>
+        struct SimdLane<double>
+        {
+            typedef SimdDouble _V;
+            const static size_t c_lanes = c_simd_doubles;
+            static SimdDouble Set(const double v) { return SimdSetDouble(v); }
+            static SimdDouble Mask(const uint32_t bits) { return SimdMaskDouble(bits); }
+            template<typename _Elem> static SimdDouble Load(const _Elem* p) { return SimdLoad<_Elem>::Double(p); }
+            template<typename _Elem> static void Store(_Elem* p, const SimdDouble v) { SimdStore<_Elem>::Double(p, v); }
+
+            constexpr static double c_ln2_hi = 6.93147180369123816490e-01;
+            constexpr static double c_ln2_lo = 1.90821492927058770002e-10;
+            constexpr static double c_exp_min = -746.0;
+            constexpr static double c_exp_max = 710.0;
+            constexpr static double c_min_normal = 2.2250738585072014e-308;
+            constexpr static double c_subnormal_scale = 4503599627370496.0; // 2^52
+            constexpr static double c_subnormal_exponent = 52.0;
+        };
+
+        inline SimdLane<float> SimdLaneOf(const SimdFloat);
+        inline SimdLane<double> SimdLaneOf(const SimdDouble);
+
+        // c0 + x * (c1 + x * (c2 + ...))
+        template<typename _V>
+        inline _V SimdPolynomial(const _V x, const double c0)
+        {
+            return decltype(SimdLaneOf(x))::Set(c0);
+        }
+
+        template<typename _V, typename... _Coefficients>
+        inline _V SimdPolynomial(const _V x, const double c0, const _Coefficients... coefficients)
+        {
+            return SimdFma(SimdPolynomial(x, coefficients...), x, decltype(SimdLaneOf(x))::Set(c0));
+        }
+
+        // The polynomials of the kernels, fitted at Chebyshev nodes. The degree depends on the accuracy:
+        // Exp(r)  ~ (exp(r) - 1 - r) / r^2                        for |r| <= ln(2) / 2
+        // Log(z)  ~ (log((1 + s) / (1 - s)) - 2s) / s^3, z = s^2  for |s| <= 0.1716
+        // Tanh(z) ~ (tanh(x) / x - 1) / x^2, z = x^2             for |x| < 0.625
+
+        // float lanes, about 4 ULP
+        struct KernelFastFloat
+        {
+            typedef SimdLane<float> _Lane;
+            typedef SimdFloat _V;
+            static _V Exp(const _V r) { return SimdPolynomial(r, 5.00000000e-01, 1.66665770e-01, 4.16665547e-02, 8.36317307e-03, 1.39261761e-03); }
+            static _V Log(const _V z) { return SimdPolynomial(z, 6.66666850e-01, 3.99887806e-01, 2.95799494e-01); }
+            static _V Tanh(const _V z) { return SimdPolynomial(z, -3.33333289e-01, 1.33327697e-01, -5.38509096e-02, 2.09971790e-02, -6.09671417e-03); }
+        };
+
+        // float results calculated in double lanes, at most 1 ULP after rounding to float
+        struct KernelFloatInDouble
+        {
+            typedef SimdLane<double> _Lane;
+            typedef SimdDouble _V;
+            static _V Exp(const _V r) { return SimdPolynomial(r, 5.0000000134577272e-01, 1.6666666681614257e-01, 4.1666465006040025e-02, 8.3333109344485890e-03, 1.3933641031987874e-03, 1.9890980869906592e-04); }
+            static _V Log(const _V z) { return SimdPolynomial(z, 6.6666666554497172e-01, 4.0000121839790716e-01, 2.8550820816820217e-01, 2.3330467201596596e-01); }
+            static _V Tanh(const _V z) { return SimdPolynomial(z, -3.3333333172140362e-01, 1.3333303556915746e-01, -5.3959259577205027e-02, 2.1768918651030410e-02, -8.3439455158433716e-03, 2.2927448161809152e-03); }
+        };
+
+        // double lanes, about 4 ULP
+        struct KernelFastDouble
+        {
+            typedef SimdLane<double> _Lane;
+            typedef SimdDouble _V;
+            static _V Exp(const _V r)
+            {
+                return SimdPolynomial(r, 5.0000000000000010e-01, 1.6666666666666690e-01, 4.1666666666624246e-02, 8.3333333333131097e-03, 1.3888888917158319e-03,
+                    1.9841269903551281e-04, 2.4801521367290842e-05, 2.7557229620198997e-06, 2.7620059685334563e-07, 2.5113360015217145e-08);
+            }
+            static _V Log(const _V z)
+            {
+                return SimdPolynomial(z, 6.6666666666667311e-01, 3.9999999999525891e-01, 2.8571428703749165e-01, 2.2222203552427141e-01, 1.8183267229231279e-01,
+                    1.5322379785461488e-01, 1.4707106671819935e-01);
+            }
+            static _V Tanh(const _V z)
+            {
+                return SimdPolynomial(z, -3.3333333333333324e-01, 1.3333333333326829e-01, -5.3968253961459515e-02, 2.1869488261768139e-02, -8.8632298442436364e-03,
+                    3.5920590692472168e-03, -1.4553097061996121e-03, 5.8743846378335035e-04, -2.3077828667180625e-04, 7.9601737670793993e-05, -1.7245847250149341e-05);
+            }
+        };
+
+        // double lanes, at most 1 ULP
+        struct KernelUlp1Double
+        {
+            typedef SimdLane<double> _Lane;
+            typedef SimdDouble _V;
+            static _V Exp(const _V r)
+            {
+                return SimdPolynomial(r, 5.0000000000000000e-01, 1.6666666666666668e-01, 4.1666666666666027e-02, 8.3333333333278845e-03, 1.3888888889272226e-03,
+                    1.9841269871082977e-04, 2.4801586520368882e-05, 2.7557258815631945e-06, 2.7557969833589316e-07, 2.5104100663305405e-08, 2.0699685430550320e-09);
+            }
+            static _V Log(const _V z)
+            {
+                return SimdPolynomial(z, 6.6666666666666659e-01, 4.0000000000067485e-01, 2.8571428542050064e-01, 2.2222227141516334e-01, 1.8181407358499454e-01,
+                    1.5403055311712853e-01, 1.2898732122257270e-01, 1.6346918645103882e-01);
+            }
+            static _V Tanh(const _V z)
+            {
+                return SimdPolynomial(z, -3.3333333333333334e-01, 1.3333333333333129e-01, -5.3968253967924386e-02, 2.1869488519408730e-02, -8.8632351055758273e-03,
+                    3.5921217434604714e-03, -1.4557752030122822e-03, 5.8965921059989653e-04, -2.3758531283174940e-04, 9.2559838894007734e-05, -3.1188044046998825e-05,
+                    6.4788036701840827e-06);
+            }
+        };
+
+        // exp(x) = 2^n * exp(r) with r = x - n * ln(2)
+        template<typename _Kernel, typename _V>
+        inline _V SimdExp(_V x)
+        {
+            typedef decltype(SimdLaneOf(x)) _Lane;
+
+            // the range is limited first, NaN is kept since SimdMin() returns the second argument for NaN
+            x = SimdMax(_Lane::Set(_Lane::c_exp_min), SimdMin(_Lane::Set(_Lane::c_exp_max), x));
+
+            const _V n = SimdRound(SimdMul(x, _Lane::Set(1.44269504088896340736)));
+            _V r = SimdFma(n, _Lane::Set(-_Lane::c_ln2_hi), x);
+            r = SimdFma(n, _Lane::Set(-_Lane::c_ln2_lo), r);
+            const _V p = SimdAdd(SimdFma(SimdMul(r, r), _Kernel::Exp(r), r), _Lane::Set(1.0));
+
+            // 2^n is applied in two steps, so results close to the overflow or in the subnormal range need no special cases
+            const _V n1 = SimdRound(SimdMul(n, _Lane::Set(0.5)));
+            return SimdMul(SimdMul(p, SimdPow2(n1)), SimdPow2(SimdSub(n, n1)));
+        }
+
+        // log(x) = k * ln(2) + log(1 + f) with 1 + f in [sqrt(1/2), sqrt(2))
+        template<typename _Kernel, typename _V>
+        inline _V SimdLog(const _V x)
+        {
+            typedef decltype(SimdLaneOf(x)) _Lane;
+
+            const _V subnormal = SimdLess(x, _Lane::Set(_Lane::c_min_normal));
+            const _V normal = SimdSelect(subnormal, SimdMul(x, _Lane::Set(_Lane::c_subnormal_scale)), x);
+            _V k = SimdSub(SimdExponent(normal), SimdAnd(subnormal, _Lane::Set(_Lane::c_subnormal_exponent)));
+            _V m = SimdMantissa(normal);
+
+            const _V high = SimdLess(_Lane::Set(1.41421356237309504880), m);
+            m = SimdSelect(high, SimdMul(m, _Lane::Set(0.5)), m);
+            k = SimdAdd(k, SimdAnd(high, _Lane::Set(1.0)));
+
+            // log(1 + f) = f - f^2 / 2 + s * (f^2 / 2 + R) with s = f / (2 + f)
+            const _V f = SimdSub(m, _Lane::Set(1.0));
+            const _V s = SimdDiv(f, SimdAdd(f, _Lane::Set(2.0)));
+            const _V z = SimdMul(s, s);
+            const _V hfsq = SimdMul(SimdMul(f, f), _Lane::Set(0.5));
+            const _V R = SimdMul(z, _Kernel::Log(z));
+            _V result = SimdFma(s, SimdAdd(hfsq, R), SimdMul(k, _Lane::Set(_Lane::c_ln2_lo)));
+            result = SimdAdd(SimdSub(f, SimdSub(hfsq, result)), SimdMul(k, _Lane::Set(_Lane::c_ln2_hi)));
+
+            result = SimdSelect(SimdEqual(x, _Lane::Set(0.0)), _Lane::Set(-std::numeric_limits<double>::infinity()), result);
+            result = SimdSelect(SimdEqual(x, _Lane::Set(std::numeric_limits<double>::infinity())), x, result);
+            return SimdSelect(SimdNotGreaterEqual(x, _Lane::Set(0.0)), _Lane::Set(std::numeric_limits<double>::quiet_NaN()), result);
+        }
+
+        // small |x| use the odd polynomial, everything else 1 - 2 / (exp(2|x|) + 1)
+        template<typename _Kernel, typename _V>
+        inline _V SimdTanh(const _V x)
+        {
+            typedef decltype(SimdLaneOf(x)) _Lane;
+
+            const _V sign = SimdAnd(x, _Lane::Set(-0.0));
+            const _V ax = SimdXor(x, sign);
+            const _V z = SimdMul(x, x);
+            const _V small = SimdFma(SimdMul(x, z), _Kernel::Tanh(z), x);
+            const _V e = SimdExp<_Kernel>(SimdAdd(ax, ax));
+            const _V large = SimdOr(SimdSub(_Lane::Set(1.0), SimdDiv(_Lane::Set(2.0), SimdAdd(e, _Lane::Set(1.0)))), sign);
+            return SimdSelect(SimdLess(ax, _Lane::Set(0.625)), small, large);
+        }
+
+        // exp(-|x|) can't overflow: 1 / (1 + e) for positive x, e / (1 + e) for negative x
+        template<typename _Kernel, typename _V>
+        inline _V SimdSigmoid(const _V x)
+        {
+            typedef decltype(SimdLaneOf(x)) _Lane;
+
+            const _V e = SimdExp<_Kernel>(SimdOr(x, _Lane::Set(-0.0)));
+            const _V one = _Lane::Set(1.0);
+            return SimdDiv(SimdSelect(SimdLess(x, _Lane::Set(0.0)), e, one), SimdAdd(e, one));
+        }
+
+        // pow(a, b) = exp(b * log(|a|)) with the sign and the special cases of std::pow()
+        template<typename _Kernel>
+        inline SimdDouble SimdPow(const SimdDouble a, const SimdDouble b)
+        {
+            typedef SimdLane<double> _Lane;
+
+            const SimdDouble sign = _Lane::Set(-0.0);
+            const SimdDouble one = _Lane::Set(1.0);
+            const SimdDouble infinity = _Lane::Set(std::numeric_limits<double>::infinity());
+            const SimdDouble abs_b = SimdAndNot(sign, b);
+
+            SimdDouble result = SimdExp<_Kernel>(SimdMul(b, SimdLog<_Kernel>(SimdAndNot(sign, a))));
+
+            // negative bases are only defined for integral exponents, odd exponents keep the sign
+            const SimdDouble integral = SimdEqual(SimdRound(b), b);
+            const SimdDouble half = SimdMul(b, _Lane::Set(0.5));
+            const SimdDouble odd = SimdAndNot(SimdEqual(SimdRound(half), half), SimdAnd(integral, SimdLess(abs_b, _Lane::Set(9007199254740992.0))));
+            result = SimdXor(result, SimdAnd(SimdAnd(a, sign), odd));
+
+            const SimdDouble negative_finite = SimdAnd(SimdLess(a, _Lane::Set(0.0)), SimdLess(SimdXor(infinity, sign), a));
+            result = SimdSelect(SimdAndNot(integral, negative_finite), _Lane::Set(std::numeric_limits<double>::quiet_NaN()), result);
+
+            // pow(a, 0) = 1, pow(1, b) = 1 and pow(-1, +-inf) = 1, even for NaN
+            const SimdDouble is_one = SimdOr(SimdOr(SimdEqual(b, _Lane::Set(0.0)), SimdEqual(a, one)),
+                SimdAnd(SimdEqual(a, _Lane::Set(-1.0)), SimdEqual(abs_b, infinity)));
+            return SimdSelect(is_one, one, result);
+        }
+
+        // 1 / sqrt(x) from the estimate of the CPU and one Newton step, the special cases use the exact version
+        inline SimdFloat SimdRsqrtFast(const SimdFloat x)
+        {
+            typedef SimdLane<float> _Lane;
+
+            const SimdFloat r = SimdRsqrtEstimate(x);
+            const SimdFloat result = SimdMul(r, SimdFma(SimdMul(SimdMul(x, _Lane::Set(-0.5)), r), r, _Lane::Set(1.5)));
+            const SimdFloat special = SimdOr(SimdLess(x, _Lane::Set(_Lane::c_min_normal)), SimdEqual(x, _Lane::Set(std::numeric_limits<double>::infinity())));
+            if (SimdAny(special))
+                return SimdSelect(special, SimdDiv(_Lane::Set(1.0), SimdSqrt(x)), result);
+            return result;
+        }
+#endif // _MATRIX_SIMD
+
+        // The functions for Transcendental(): Standard() is the standard library version, Simd() the kernel.
+        // c_double_ulp1 tells if the kernel stays within 1 ULP for double, otherwise the standard library is used.
+        struct FnExp
+        {
+            template<typename _A> static auto Standard(const _A a) -> decltype(std::exp(a)) { return std::exp(a); }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdExp<_Kernel>(a); }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = true;
+        };
+
+        struct FnLog
+        {
+            template<typename _A> static auto Standard(const _A a) -> decltype(std::log(a)) { return std::log(a); }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdLog<_Kernel>(a); }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = true;
+        };
+
+        // the square root instruction is correctly rounded, only the fast float version differs
+        struct FnSqrt
+        {
+            template<typename _A> static auto Standard(const _A a) -> decltype(std::sqrt(a)) { return std::sqrt(a); }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdSqrt(a); }
+            template<typename _Kernel> static SimdFloat Simd(const SimdFloat a)
+            {
+                typedef SimdLane<float> _Lane;
+                if (std::is_same<_Kernel, KernelFastFloat>::value)
+                {
+                    const SimdFloat keep = SimdOr(SimdEqual(a, _Lane::Set(0.0)), SimdEqual(a, _Lane::Set(std::numeric_limits<double>::infinity())));
+                    return SimdSelect(keep, a, SimdMul(a, SimdRsqrtFast(a)));
+                }
+                return SimdSqrt(a);
+            }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = true;
+        };
+
+        struct FnRsqrt
+        {
+            template<typename _A> static auto Standard(const _A a) -> decltype(1 / std::sqrt(a)) { return 1 / std::sqrt(a); }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdDiv(decltype(SimdLaneOf(a))::Set(1.0), SimdSqrt(a)); }
+            template<typename _Kernel> static SimdFloat Simd(const SimdFloat a)
+            {
+                if (std::is_same<_Kernel, KernelFastFloat>::value)
+                    return SimdRsqrtFast(a);
+                return SimdDiv(SimdLane<float>::Set(1.0), SimdSqrt(a));
+            }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = false;
+        };
+
+        struct FnTanh
+        {
+            template<typename _A> static auto Standard(const _A a) -> decltype(std::tanh(a)) { return std::tanh(a); }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdTanh<_Kernel>(a); }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = false;
+        };
+
+        struct FnSigmoid
+        {
+            // exp(a) / (1 + exp(a)) for negative a, so it doesn't underflow before exp(-a) overflows
+            template<typename _A> static auto Standard(const _A a) -> decltype(1 / (1 + std::exp(-a)))
+            {
+                if (a < 0)
+                    return std::exp(a) / (1 + std::exp(a));
+                return 1 / (1 + std::exp(-a));
+            }
+#ifdef _MATRIX_SIMD
+            template<typename _Kernel, typename _V> static _V Simd(const _V a) { return SimdSigmoid<_Kernel>(a); }
+#endif // _MATRIX_SIMD
+            const static bool c_double_ulp1 = false;
+        };
+
+#ifdef _MATRIX_SIMD
+        // b[i] = f(a[i]) with the lanes of the kernel, the remaining elements are padded to a full register
+        template<typename _Fn, typename _Kernel, typename _Elem>
+        inline void TranscendentalSimd(const _Elem* a, _Elem* b, const size_t count)
+        {
+            typedef typename _Kernel::_Lane _Lane;
+
+            const size_t end = count - (count % _Lane::c_lanes);
+            for (size_t i = 0; i < end; i += _Lane::c_lanes)
+                _Lane::Store(b + i, _Fn::template Simd<_Kernel>(_Lane::Load(a + i)));
+
+            if (end == count)
+                return;
+
+            _Elem tail[_Lane::c_lanes] = {};
+            std::copy(a + end, a + count, tail);
+            _Lane::Store(tail, _Fn::template Simd<_Kernel>(_Lane::Load(tail)));
+            std::copy(tail, tail + (count - end), b + end);
+        }
+#endif // _MATRIX_SIMD
+
+        // b[i] = f(a[i]) for [count] elements. Only float -> float and double -> double have kernels,
+        // all other combinations use the standard library like before.
+        template<typename _Fn, typename _ElemA, typename _ElemB>
+        inline void TranscendentalRange(const _ElemA* a, _ElemB* b, const size_t count, const Accuracy)
+        {
+            for (size_t i = 0; i < count; i++)
+                b[i] = _ElemB(_Fn::Standard(a[i]));
+        }
+
+        template<typename _Fn>
+        inline void TranscendentalRange(const float* a, float* b, const size_t count, const Accuracy accuracy)
+        {
+#ifdef _MATRIX_SIMD
+            switch (ResolveAccuracy(accuracy))
+            {
+            case Accuracy::Fast:
+                return TranscendentalSimd<_Fn, KernelFastFloat>(a, b, count);
+            case Accuracy::Ulp1:
+                return TranscendentalSimd<_Fn, KernelFloatInDouble>(a, b, count);
+            default:
+                break;
+            }
+#else
+            (void)accuracy;
+#endif // _MATRIX_SIMD
+
+            for (size_t i = 0; i < count; i++)
+                b[i] = float(_Fn::Standard(a[i]));
+        }
+
+        template<typename _Fn>
+        inline void TranscendentalRange(const double* a, double* b, const size_t count, const Accuracy accuracy)
+        {
+#ifdef _MATRIX_SIMD
+            switch (ResolveAccuracy(accuracy))
+            {
+            case Accuracy::Fast:
+                return TranscendentalSimd<_Fn, KernelFastDouble>(a, b, count);
+            case Accuracy::Ulp1:
+                if (_Fn::c_double_ulp1)
+                    return TranscendentalSimd<_Fn, KernelUlp1Double>(a, b, count);
+                break;
+            default:
+                break;
+            }
+#else
+            (void)accuracy;
+#endif // _MATRIX_SIMD
+
+            for (size_t i = 0; i < count; i++)
+                b[i] = _Fn::Standard(a[i]);
+        }
+
+        template<typename _Fn, typename _ElemA, typename _ElemB>
+        inline void Transcendental(const _ElemA* a, _ElemB* b, const size_t count, const Accuracy accuracy)
+        {
+            ParallelElements<_ElemB>(count, [=](const size_t begin, const size_t end)
+                {
+                    TranscendentalRange<_Fn>(a + begin, b + begin, end - begin, accuracy);
+                });
+        }
+
+        // The operands of PowEBE(): a matrix or the same scalar for all elements
+        template<typename _Elem>
+        struct ArrayOperand
+        {
+            const _Elem* p;
+
+            const static bool c_scalar = false;
+            typedef _Elem _Type;
+            _Elem operator [] (const size_t i) const { return p[i]; }
+            ArrayOperand Offset(const size_t i) const { return ArrayOperand{ p + i }; }
+#ifdef _MATRIX_SIMD
+            SimdDouble Load(const size_t i) const { return SimdLoad<_Elem>::Double(p + i); }
+#endif // _MATRIX_SIMD
+        };
+
+        template<typename _Elem>
+        struct ScalarOperand
+        {
+            _Elem value;
+
+            const static bool c_scalar = true;
+            typedef _Elem _Type;
+            _Elem operator [] (const size_t) const { return value; }
+            ScalarOperand Offset(const size_t) const { return *this; }
+#ifdef _MATRIX_SIMD
+            SimdDouble Load(const size_t) const { return SimdLane<double>::Set(double(value)); }
+#endif // _MATRIX_SIMD
+        };
+
+        // Selects the kernel of Pow(): matrices need the type of the result, scalars can be of any arithmetic type.
+        // 0 = standard library only, 1 = float result, 2 = double result
+        template<typename _OpA, typename _OpB, typename _ElemC>
+        struct PowPath
+        {
+            template<typename _Op>
+            struct Fits
+            {
+                const static bool c_value = _Op::c_scalar ? std::is_arithmetic<typename _Op::_Type>::value :
+                    std::is_same<typename _Op::_Type, _ElemC>::value;
+            };
+
+            const static int c_value = (not Fits<_OpA>::c_value or not Fits<_OpB>::c_value) ? 0 :
+                std::is_same<_ElemC, float>::value ? 1 : std::is_same<_ElemC, double>::value ? 2 : 0;
+        };
+
+#ifdef _MATRIX_SIMD_AVX2
+        // c[i] = pow(a[i], b[i]) in double lanes, the remaining elements are padded to a full register
+        template<typename _Kernel, typename _OpA, typename _OpB, typename _ElemC>
+        inline void PowSimd(const _OpA a, const _OpB b, _ElemC* c, const size_t count)
+        {
+            const size_t end = count - (count % c_simd_doubles);
+            for (size_t i = 0; i < end; i += c_simd_doubles)
+                SimdStore<_ElemC>::Double(c + i, SimdPow<_Kernel>(a.Load(i), b.Load(i)));
+
+            if (end == count)
+                return;
+
+            double tail_a[c_simd_doubles], tail_b[c_simd_doubles], tail_c[c_simd_doubles];
+            for (size_t i = 0; i < c_simd_doubles; i++)
+            {
+                tail_a[i] = (end + i < count) ? double(a[end + i]) : 1.0;
+                tail_b[i] = (end + i < count) ? double(b[end + i]) : 1.0;
+            }
+            SimdStore<double>::Double(tail_c, SimdPow<_Kernel>(SimdLoad<double>::Double(tail_a), SimdLoad<double>::Double(tail_b)));
+            for (size_t i = 0; end + i < count; i++)
+                c[end + i] = _ElemC(tail_c[i]);
+        }
+#endif // _MATRIX_SIMD_AVX2
+
+        template<typename _OpA, typename _OpB, typename _ElemC>
+        inline void Pow(const _OpA a, const _OpB b, _ElemC* c, const size_t count, const Accuracy, std::integral_constant<int, 0>)
+        {
+            for (size_t i = 0; i < count; i++)
+                c[i] = _ElemC(std::pow(a[i], b[i]));
+        }
+
+        // float results are always calculated in double lanes, the shorter polynomials are accurate enough for float.
+        // Both kernels need four double lanes, with SSE2 the standard library is just as fast.
+        template<typename _OpA, typename _OpB>
+        inline void Pow(const _OpA a, const _OpB b, float* c, const size_t count, const Accuracy accuracy, std::integral_constant<int, 1>)
+        {
+#ifdef _MATRIX_SIMD_AVX2
+            if (ResolveAccuracy(accuracy) != Accuracy::Standard)
+                return PowSimd<KernelFloatInDouble>(a, b, c, count);
+#else
+            (void)accuracy;
+#endif // _MATRIX_SIMD_AVX2
+
+            for (size_t i = 0; i < count; i++)
+                c[i] = float(std::pow(a[i], b[i]));
+        }
+
+        // exp(b * log(a)) loses the accuracy of log(a) for large results, so double only uses the kernel in fast mode
+        template<typename _OpA, typename _OpB>
+        inline void Pow(const _OpA a, const _OpB b, double* c, const size_t count, const Accuracy accuracy, std::integral_constant<int, 2>)
+        {
+#ifdef _MATRIX_SIMD_AVX2
+            if (ResolveAccuracy(accuracy) == Accuracy::Fast)
+                return PowSimd<KernelFastDouble>(a, b, c, count);
+#else
+            (void)accuracy;
+#endif // _MATRIX_SIMD_AVX2
+
+            for (size_t i = 0; i < count; i++)
+                c[i] = double(std::pow(a[i], b[i]));
+        }
+
+        // c[i] = pow(a[i], b[i]) for [count] elements
+        template<typename _OpA, typename _OpB, typename _ElemC>
+        inline void Pow(const _OpA a, const _OpB b, _ElemC* c, const size_t count, const Accuracy accuracy)
+        {
+            ParallelElements<_ElemC>(count, [=](const size_t begin, const size_t end)
+                {
+                    Pow(a.Offset(begin), b.Offset(begin), c + begin, end - begin, accuracy,
+                        std::integral_constant<int, PowPath<_OpA, _OpB, _ElemC>::c_value>());
+                });
+        }
+
+        // a * b + c, with a single rounding where the SIMD kernels use FMA instructions as well, so
+        // the remaining elements get the same results as the vectorized ones
+        template<typename _Type>
+        inline _Type Fma(const _Type a, const _Type b, const _Type c) { return _Type(a * b + c); }
+#ifdef __FMA__
+        inline float Fma(const float a, const float b, const float c) { return std::fma(a, b, c); }
+        inline double Fma(const double a, const double b, const double c) { return std::fma(a, b, c); }
+#endif // __FMA__
+
+        // The type the fused operations calculate in. Scalars don't promote floating point matrices (0.5 * float
+        // stays float), integer matrices are calculated like the plain expression.
+        template<typename _Matrices, typename _Expression>
+        struct FusedCalc
+        {
+            typedef typename std::conditional<std::is_floating_point<_Matrices>::value, _Matrices, _Expression>::type _Type;
+        };
+
+        template<typename _Calc>
+        struct OpFma
+        {
+            _Calc Apply(const _Calc a, const _Calc b, const _Calc c) const { return Fma(a, b, c); }
+#ifdef _MATRIX_SIMD
+            template<typename _V> _V Apply(const _V a, const _V b, const _V c) const { return SimdFma(a, b, c); }
+#endif // _MATRIX_SIMD
+        };
+
+        template<typename _Calc>
+        struct OpAxpy
+        {
+            _Calc alpha;
+
+            _Calc Apply(const _Calc x, const _Calc y) const { return Fma(alpha, x, y); }
+#ifdef _MATRIX_SIMD
+            template<typename _V> _V Apply(const _V x, const _V y) const { return SimdFma(decltype(SimdLaneOf(x))::Set(alpha), x, y); }
+#endif // _MATRIX_SIMD
+        };
+
+        template<typename _Calc>
+        struct OpAxpby
+        {
+            _Calc alpha;
+            _Calc beta;
+
+            _Calc Apply(const _Calc x, const _Calc y) const { return Fma(alpha, x, _Calc(beta * y)); }
+#ifdef _MATRIX_SIMD
+            template<typename _V> _V Apply(const _V x, const _V y) const
+            {
+                typedef decltype(SimdLaneOf(x)) _Lane;
+                return SimdFma(_Lane::Set(alpha), x, SimdMul(_Lane::Set(beta), y));
+            }
+#endif // _MATRIX_SIMD
+        };
+
+        // alpha * x, Axpby() with beta = 0 overwrites y without reading it
+        template<typename _Calc>
+        struct OpScale
+        {
+            _Calc alpha;
+
+            _Calc Apply(const _Calc x) const { return _Calc(alpha * x); }
+#ifdef _MATRIX_SIMD
+            template<typename _V> _V Apply(const _V x) const { return SimdMul(decltype(SimdLaneOf(x))::Set(alpha), x); }
+#endif // _MATRIX_SIMD
+        };
+
+        // a + t * (b - a) as t * b + (a - t * a), which gives exactly a for t = 0 and exactly b for t = 1.
+        // t is a scalar or the third operand.
+        template<typename _Calc>
+        struct OpLerp
+        {
+            _Calc t;
+
+            _Calc Apply(const _Calc a, const _Calc b) const { return Fma(t, b, Fma(_Calc(-t), a, a)); }
+            _Calc Apply(const _Calc a, const _Calc b, const _Calc t_i) const { return Fma(t_i, b, Fma(_Calc(-t_i), a, a)); }
+#ifdef _MATRIX_SIMD
+            template<typename _V> _V Apply(const _V a, const _V b) const
+            {
+                typedef decltype(SimdLaneOf(a)) _Lane;
+                return SimdFma(_Lane::Set(t), b, SimdFma(_Lane::Set(-t), a, a));
+            }
+
+            template<typename _V> _V Apply(const _V a, const _V b, const _V t_i) const
+            {
+                return SimdFma(t_i, b, SimdFma(SimdSub(decltype(SimdLaneOf(a))::Set(0.0), t_i), a, a));
+            }
+#endif // _MATRIX_SIMD
+        };
+
+        // Fused operations have a kernel if all matrices are float or all are double
+        template<typename _Calc, typename _ElemOut, typename... _Elems>
+        struct FusedSimd
+        {
+            template<typename... _Types> struct AllSame : std::true_type {};
+            template<typename _First, typename... _Rest> struct AllSame<_First, _Rest...> :
+                std::integral_constant<bool, std::is_same<_First, _Calc>::value and AllSame<_Rest...>::value> {};
+
+#ifdef _MATRIX_SIMD
+            const static bool c_value = (std::is_same<_Calc, float>::value or std::is_same<_Calc, double>::value) and
+                AllSame<_ElemOut, _Elems...>::value;
+#else
+            const static bool c_value = false;
+#endif // _MATRIX_SIMD
+        };
+
+        // The SIMD part of Fused(), returns the number of processed elements
+        template<typename _Calc, typename _Op, typename _ElemOut, typename... _Elems>
+        inline size_t FusedRange(_ElemOut*, const size_t, const _Op&, std::false_type, const _Elems*...)
+        {
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline size_t FusedRange(_Calc* out, const size_t count, const _Op& op, std::true_type, const _Elems*... in)
+        {
+            typedef SimdLane<_Calc> _Lane;
+
+            const size_t end = count - (count % _Lane::c_lanes);
+            for (size_t i = 0; i < end; i += _Lane::c_lanes)
+                _Lane::Store(out + i, op.Apply(_Lane::Load(in + i)...));
+            return end;
+        }
+#endif // _MATRIX_SIMD
+
+        // out[i] = _ElemOut(op.Apply(in[i]...)) for [count] elements, calculated in _Calc. [out] may be one of the inputs.
+        template<typename _Calc, typename _ElemOut, typename _Op, typename... _Elems>
+        inline void Fused(_ElemOut* out, const size_t count, const _Op op, const _Elems*... in)
+        {
+            ParallelElements<_ElemOut>(count, [=](const size_t begin, const size_t end)
+                {
+                    size_t i = begin + FusedRange<_Calc>(out + begin, end - begin, op,
+                        std::integral_constant<bool, FusedSimd<_Calc, _ElemOut, _Elems...>::c_value>(), (in + begin)...);
+
+                    for (; i < end; i++)
+                        out[i] = _ElemOut(op.Apply(_Calc(in[i])...));
+                });
+        }
+
+        // p[i] = value for [count] elements
+        template<typename _Elem>
+        inline void FillRange(_Elem* p, const size_t count, const _Elem value, const bool)
+        {
+            for (size_t i = 0; i < count; i++)
+                p[i] = value;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Elem>
+        inline void FillStream(_Elem* p, const size_t count, const _Elem value)
+        {
+            typedef SimdLane<_Elem> _Lane;
+
+            const typename _Lane::_V v = _Lane::Set(value);
+
+            size_t i = 0;
+            for (const size_t peel = std::min(SimdStreamPeel(p), count); i < peel; i++)
+                p[i] = value;
+            for (; i + _Lane::c_lanes <= count; i += _Lane::c_lanes)
+                SimdStream(p + i, v);
+            SimdStreamFence();
+            for (; i < count; i++)
+                p[i] = value;
+        }
+
+        inline void FillRange(float* p, const size_t count, const float value, const bool stream)
+        {
+            if (stream) FillStream(p, count, value);
+            else std::fill(p, p + count, value);
+        }
+
+        inline void FillRange(double* p, const size_t count, const double value, const bool stream)
+        {
+            if (stream) FillStream(p, count, value);
+            else std::fill(p, p + count, value);
+        }
+#endif // _MATRIX_SIMD
+
+        template<typename _Elem>
+        inline void Fill(_Elem* p, const size_t count, const _Elem value)
+        {
+            const bool stream = UseStreamingStores(count * sizeof(_Elem));
+
+            ParallelElements<_Elem>(count, [=](const size_t begin, const size_t end)
+                {
+                    FillRange(p + begin, end - begin, value, stream);
+                });
+        }
+
+        // Sets [bytes] to zero
+        inline void ZeroRange(char* p, const size_t bytes, const bool stream)
+        {
+#ifdef _MATRIX_SIMD
+            if (stream)
+            {
+                const size_t peel = std::min(SimdStreamPeel(p), bytes);
+                memset(p, 0, peel);
+
+                size_t i = peel;
+                for (; i + c_simd_bytes <= bytes; i += c_simd_bytes)
+                    SimdStreamZero(p + i);
+                SimdStreamFence();
+
+                memset(p + i, 0, bytes - i);
+                return;
+            }
+#else
+            (void)stream;
+#endif // _MATRIX_SIMD
+
+            memset(p, 0, bytes);
+        }
+
+        template<typename _Elem>
+        inline void Zero(_Elem* p, const size_t count)
+        {
+            const bool stream = UseStreamingStores(count * sizeof(_Elem));
+
+            ParallelElements<_Elem>(count, [=](const size_t begin, const size_t end)
+                {
+                    ZeroRange((char*)(p + begin), (end - begin) * sizeof(_Elem), stream);
+                });
+        }
+
+        // b[i] = a[-1 - i] for [count] elements, [a] points behind the element which ends up in b[0]
+        template<typename _ElemA, typename _ElemB>
+        inline void ReverseRange(const _ElemA* a, _ElemB* b, const size_t count, const bool)
+        {
+            for (size_t i = 0; i < count; i++)
+                b[i] = _ElemB(*(a - 1 - i));
+        }
+
+#ifdef _MATRIX_SIMD
+#ifdef _MATRIX_SIMD_AVX2
+        inline SimdFloat SimdReverse(const SimdFloat v) { return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+        inline SimdDouble SimdReverse(const SimdDouble v) { return _mm256_permute4x64_pd(v, 0x1B); }
+#else
+        inline SimdFloat SimdReverse(const SimdFloat v) { return _mm_shuffle_ps(v, v, 0x1B); }
+        inline SimdDouble SimdReverse(const SimdDouble v) { return _mm_shuffle_pd(v, v, 1); }
+#endif // _MATRIX_SIMD_AVX2
+
+        template<typename _Elem>
+        inline void ReverseSimd(const _Elem* a, _Elem* b, const size_t count, const bool stream)
+        {
+            typedef SimdLane<_Elem> _Lane;
+
+            size_t i = 0;
+
+            if (stream)
+            {
+                for (const size_t peel = std::min(SimdStreamPeel(b), count); i < peel; i++)
+                    b[i] = *(a - 1 - i);
+                for (; i + _Lane::c_lanes <= count; i += _Lane::c_lanes)
+                    SimdStream(b + i, SimdReverse(_Lane::Load(a - i - _Lane::c_lanes)));
+                SimdStreamFence();
+            }
+            else
+            {
+                const size_t vector_end = count - (count % _Lane::c_lanes);
+                for (; i < vector_end; i += _Lane::c_lanes)
+                    _Lane::Store(b + i, SimdReverse(_Lane::Load(a - i - _Lane::c_lanes)));
+            }
+
+            for (; i < count; i++)
+                b[i] = *(a - 1 - i);
+        }
+
+        inline void ReverseRange(const float* a, float* b, const size_t count, const bool stream) { ReverseSimd(a, b, count, stream); }
+        inline void ReverseRange(const double* a, double* b, const size_t count, const bool stream) { ReverseSimd(a, b, count, stream); }
+#endif // _MATRIX_SIMD
+
+        // b[i] = _ElemB(a[count - 1 - i]) for [count] elements
+        template<typename _ElemA, typename _ElemB>
+        inline void Reverse(const _ElemA* a, _ElemB* b, const size_t count)
+        {
+            const bool stream = UseStreamingStores(count * sizeof(_ElemB));
+
+            ParallelElements<_ElemB>(count, [=](const size_t begin, const size_t end)
+                {
+                    ReverseRange(a + (count - begin), b + begin, end - begin, stream);
+                });
+        }
+
+        template<typename _Type>
+        inline _Type ScalarAbs(const _Type a, std::true_type) { return (a < _Type(0)) ? _Type(-a) : a; }
+        template<typename _Type>
+        inline _Type ScalarAbs(const _Type a, std::false_type) { return a; }
+
+        // The values the reductions add up, usable on scalars and on SIMD registers.
+        // Accumulate() adds them to a SIMD accumulator, with FMA for products.
+        struct ReduceValue
+        {
+            template<typename _Type> static _Type Apply(const _Type a) { return a; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Accumulate(const _V sum, const _V a) { return SimdAdd(sum, a); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct ReduceAbs
+        {
+            template<typename _Type> static _Type Apply(const _Type a) { return ScalarAbs(a, std::is_signed<_Type>()); }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a) { return SimdAndNot(SimdSetFloat(-0.0f), a); }
+            static SimdDouble Apply(const SimdDouble a) { return SimdAndNot(SimdSetDouble(-0.0), a); }
+            template<typename _V> static _V Accumulate(const _V sum, const _V a) { return SimdAdd(sum, Apply(a)); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct ReduceSquare
+        {
+            template<typename _Type> static _Type Apply(const _Type a) { return a * a; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a) { return SimdMul(a, a); }
+            static SimdDouble Apply(const SimdDouble a) { return SimdMul(a, a); }
+            template<typename _V> static _V Accumulate(const _V sum, const _V a) { return SimdFma(a, a, sum); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct ReduceProduct
+        {
+            template<typename _Type> static _Type Apply(const _Type a, const _Type b) { return a * b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat a, const SimdFloat b) { return SimdMul(a, b); }
+            static SimdDouble Apply(const SimdDouble a, const SimdDouble b) { return SimdMul(a, b); }
+            template<typename _V> static _V Accumulate(const _V sum, const _V a, const _V b) { return SimdFma(a, b, sum); }
+#endif // _MATRIX_SIMD
+        };
+
+        // sum of op(in[i]...) for [count] elements with four independent accumulators
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline _Calc SumFast(const size_t count, std::false_type, const _Elems*... in)
+        {
+            _Calc sum0 = _Calc(0), sum1 = _Calc(0), sum2 = _Calc(0), sum3 = _Calc(0);
+
+            const size_t unrolled_end = count - (count % 4);
+            for (size_t i = 0; i < unrolled_end; i += 4)
+            {
+                sum0 += _Op::Apply(_Calc(in[i])...);
+                sum1 += _Op::Apply(_Calc(in[i + 1])...);
+                sum2 += _Op::Apply(_Calc(in[i + 2])...);
+                sum3 += _Op::Apply(_Calc(in[i + 3])...);
+            }
+            for (size_t i = unrolled_end; i < count; i++)
+                sum0 += _Op::Apply(_Calc(in[i])...);
+
+            return (sum0 + sum1) + (sum2 + sum3);
+        }
+
+        // Adds [x] to [sum] and returns the rounding error of the addition (Neumaier)
+        template<typename _Calc>
+        inline _Calc TwoSum(_Calc& sum, const _Calc x)
+        {
+            const _Calc t = sum + x;
+            const _Calc error = (std::abs(sum) >= std::abs(x)) ? ((sum - t) + x) : ((x - t) + sum);
+            sum = t;
+            return error;
+        }
+
+        // Second order Neumaier summation: the rounding errors are summed up compensated as well, with a
+        // single compensation the error of the compensation itself grows with the number of elements.
+        template<typename _Calc>
+        struct CompensatedSum
+        {
+            _Calc sum = _Calc(0), comp = _Calc(0), comp2 = _Calc(0);
+
+            void Add(const _Calc x) { comp2 += TwoSum(comp, TwoSum(sum, x)); }
+            _Calc Result(void) const { return sum + (comp + comp2); }
+        };
+
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline _Calc SumCompensated(const size_t count, std::false_type, const _Elems*... in)
+        {
+            CompensatedSum<_Calc> sum;
+            for (size_t i = 0; i < count; i++)
+                sum.Add(_Op::Apply(_Calc(in[i])...));
+            return sum.Result();
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline _Calc SumFast(const size_t count, std::true_type, const _Elems*... in)
+        {
+            typedef SimdLane<_Calc> _Lane;
+            constexpr size_t c_lanes = _Lane::c_lanes;
+
+            typename _Lane::_V sum0 = _Lane::Set(0.0), sum1 = sum0, sum2 = sum0, sum3 = sum0;
+
+            size_t i = 0;
+            for (; i + (4 * c_lanes) <= count; i += 4 * c_lanes)
+            {
+                sum0 = _Op::Accumulate(sum0, _Lane::Load(in + i)...);
+                sum1 = _Op::Accumulate(sum1, _Lane::Load(in + i + c_lanes)...);
+                sum2 = _Op::Accumulate(sum2, _Lane::Load(in + i + (2 * c_lanes))...);
+                sum3 = _Op::Accumulate(sum3, _Lane::Load(in + i + (3 * c_lanes))...);
+            }
+            for (; i + c_lanes <= count; i += c_lanes)
+                sum0 = _Op::Accumulate(sum0, _Lane::Load(in + i)...);
+
+            _Calc lanes[c_lanes];
+            _Lane::Store(lanes, SimdAdd(SimdAdd(sum0, sum1), SimdAdd(sum2, sum3)));
+
+            _Calc sum = _Calc(0);
+            for (size_t lane = 0; lane < c_lanes; lane++)
+                sum += lanes[lane];
+            for (; i < count; i++)
+                sum += _Op::Apply(in[i]...);
+            return sum;
+        }
+
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline _Calc SumCompensated(const size_t count, std::true_type, const _Elems*... in)
+        {
+            typedef SimdLane<_Calc> _Lane;
+            typedef typename _Lane::_V _V;
+            constexpr size_t c_lanes = _Lane::c_lanes;
+
+            const _V sign = _Lane::Set(-0.0);
+            const auto two_sum = [sign](_V& sum, const _V x)
+            {
+                const _V t = SimdAdd(sum, x);
+                const _V x_larger = SimdLess(SimdAndNot(sign, sum), SimdAndNot(sign, x));
+                const _V error = SimdSelect(x_larger, SimdAdd(SimdSub(x, t), sum), SimdAdd(SimdSub(sum, t), x));
+                sum = t;
+                return error;
+            };
+
+            _V sum = _Lane::Set(0.0), comp = sum, comp2 = sum;
+
+            const size_t vector_end = count - (count % c_lanes);
+            for (size_t i = 0; i < vector_end; i += c_lanes)
+                comp2 = SimdAdd(comp2, two_sum(comp, two_sum(sum, _Op::Apply(_Lane::Load(in + i)...))));
+
+            _Calc sums[c_lanes], comps[c_lanes], comps2[c_lanes];
+            _Lane::Store(sums, sum);
+            _Lane::Store(comps, comp);
+            _Lane::Store(comps2, comp2);
+
+            CompensatedSum<_Calc> total;
+            for (size_t lane = 0; lane < c_lanes; lane++)
+            {
+                total.Add(sums[lane]);
+                total.comp2 += TwoSum(total.comp, comps[lane]) + comps2[lane];
+            }
+            for (size_t i = vector_end; i < count; i++)
+                total.Add(_Op::Apply(in[i]...));
+            return total.Result();
+        }
+#endif // _MATRIX_SIMD
+
+        template<typename _Calc, typename _Op, typename _Simd, typename... _Elems>
+        inline _Calc SumPairwise(const size_t count, const _Simd simd, const _Elems*... in)
+        {
+            constexpr size_t c_block = 256;
+            if (count <= c_block)
+                return SumFast<_Calc, _Op>(count, simd, in...);
+
+            // the first half stays a multiple of a register, so all loads of the blocks are full
+            const size_t half = ((count / 2) + 15) & ~size_t(15);
+            return SumPairwise<_Calc, _Op>(half, simd, in...) + SumPairwise<_Calc, _Op>(count - half, simd, (in + half)...);
+        }
+
+        // The summation modes only differ for floating point numbers
+        template<typename _Calc, typename _Op, typename _Simd, typename... _Elems>
+        inline _Calc SumRange(const size_t count, const Summation, std::false_type, const _Simd simd, const _Elems*... in)
+        {
+            return SumFast<_Calc, _Op>(count, simd, in...);
+        }
+
+        template<typename _Calc, typename _Op, typename _Simd, typename... _Elems>
+        inline _Calc SumRange(const size_t count, const Summation summation, std::true_type, const _Simd simd, const _Elems*... in)
+        {
+            switch (summation)
+            {
+            case Summation::Pairwise:
+                return SumPairwise<_Calc, _Op>(count, simd, in...);
+            case Summation::Compensated:
+                return SumCompensated<_Calc, _Op>(count, simd, in...);
+            default:
+                return SumFast<_Calc, _Op>(count, simd, in...);
+            }
+        }
+
+        // sum of op(in[i]...) for [count] elements, calculated in _Calc. Float and double matrices use SIMD
+        // kernels, large matrices are split across the threads and the partial sums are added up in order.
+        template<typename _Calc, typename _Op, typename... _Elems>
+        inline _Calc Reduce(const size_t count, const Summation summation, const _Elems*... in)
+        {
+            typedef std::integral_constant<bool, FusedSimd<_Calc, _Calc, _Elems...>::c_value> _Simd;
+            typedef std::integral_constant<bool, std::is_floating_point<_Calc>::value> _Floating;
+
+            return ParallelReduce<_Calc, _Calc>(count, [=](const size_t begin, const size_t end)
+                {
+                    return SumRange<_Calc, _Op>(end - begin, summation, _Floating(), _Simd(), (in + begin)...);
+                },
+                [](const _Calc a, const _Calc b) { return _Calc(a + b); });
+        }
+
+        // Comparisons of Min() and Max(). The SIMD instructions return their second operand if one is NaN,
+        // with the new value first NaNs are skipped like in the scalar code.
+        struct ExtremeMin
+        {
+            template<typename _Type> static _Type Identity(void)
+            {
+                return std::numeric_limits<_Type>::has_infinity ? std::numeric_limits<_Type>::infinity() : std::numeric_limits<_Type>::max();
+            }
+
+            template<typename _Type> static _Type Apply(const _Type best, const _Type x) { return (x < best) ? x : best; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat best, const SimdFloat x) { return SimdMin(x, best); }
+            static SimdDouble Apply(const SimdDouble best, const SimdDouble x) { return SimdMin(x, best); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct ExtremeMax
+        {
+            template<typename _Type> static _Type Identity(void)
+            {
+                return std::numeric_limits<_Type>::has_infinity ? _Type(-std::numeric_limits<_Type>::infinity()) : std::numeric_limits<_Type>::lowest();
+            }
+
+            template<typename _Type> static _Type Apply(const _Type best, const _Type x) { return (best < x) ? x : best; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat best, const SimdFloat x) { return SimdMax(x, best); }
+            static SimdDouble Apply(const SimdDouble best, const SimdDouble x) { return SimdMax(x, best); }
+#endif // _MATRIX_SIMD
+        };
+
+        // The smallest or largest op(a[i]) of [count] elements
+        template<typename _Cmp, typename _Op, typename _Elem>
+        inline _Elem ExtremeRange(const _Elem* a, const size_t count, std::false_type)
+        {
+            _Elem best = _Cmp::template Identity<_Elem>();
+            for (size_t i = 0; i < count; i++)
+                best = _Cmp::Apply(best, _Op::Apply(a[i]));
+            return best;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Cmp, typename _Op, typename _Elem>
+        inline _Elem ExtremeRange(const _Elem* a, const size_t count, std::true_type)
+        {
+            typedef SimdLane<_Elem> _Lane;
+            constexpr size_t c_lanes = _Lane::c_lanes;
+
+            typename _Lane::_V best0 = _Lane::Set(_Cmp::template Identity<_Elem>()), best1 = best0, best2 = best0, best3 = best0;
+
+            size_t i = 0;
+            for (; i + (4 * c_lanes) <= count; i += 4 * c_lanes)
+            {
+                best0 = _Cmp::Apply(best0, _Op::Apply(_Lane::Load(a + i)));
+                best1 = _Cmp::Apply(best1, _Op::Apply(_Lane::Load(a + i + c_lanes)));
+                best2 = _Cmp::Apply(best2, _Op::Apply(_Lane::Load(a + i + (2 * c_lanes))));
+                best3 = _Cmp::Apply(best3, _Op::Apply(_Lane::Load(a + i + (3 * c_lanes))));
+            }
+            for (; i + c_lanes <= count; i += c_lanes)
+                best0 = _Cmp::Apply(best0, _Op::Apply(_Lane::Load(a + i)));
+
+            _Elem lanes[c_lanes];
+            _Lane::Store(lanes, _Cmp::Apply(_Cmp::Apply(best0, best1), _Cmp::Apply(best2, best3)));
+
+            _Elem best = lanes[0];
+            for (size_t lane = 1; lane < c_lanes; lane++)
+                best = _Cmp::Apply(best, lanes[lane]);
+            for (; i < count; i++)
+                best = _Cmp::Apply(best, _Op::Apply(a[i]));
+            return best;
+        }
+#endif // _MATRIX_SIMD
+
+        template<typename _Cmp, typename _Op, typename _Elem>
+        inline _Elem Extreme(const _Elem* a, const size_t count)
+        {
+            typedef std::integral_constant<bool, FusedSimd<_Elem, _Elem>::c_value> _Simd;
+
+            return ParallelReduce<_Elem, _Elem>(count, [=](const size_t begin, const size_t end)
+                {
+                    return ExtremeRange<_Cmp, _Op>(a + begin, end - begin, _Simd());
+                },
+                [](const _Elem best, const _Elem x) { return _Cmp::Apply(best, x); });
+        }
+
+        // The index of the first element equal to [value], 0 if there is none
+        template<typename _Elem>
+        inline size_t FindFirst(const _Elem* a, const size_t count, const _Elem value, std::false_type)
+        {
+            for (size_t i = 0; i < count; i++)
+                if (a[i] == value)
+                    return i;
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Elem>
+        inline size_t FindFirst(const _Elem* a, const size_t count, const _Elem value, std::true_type)
+        {
+            typedef SimdLane<_Elem> _Lane;
+
+            const typename _Lane::_V v = _Lane::Set(value);
+
+            size_t i = 0;
+            for (; i + _Lane::c_lanes <= count; i += _Lane::c_lanes)
+                if (SimdAny(SimdEqual(_Lane::Load(a + i), v)))
+                    break;
+
+            return i + FindFirst(a + i, count - i, value, std::false_type());
+        }
+#endif // _MATRIX_SIMD
+
+        // Column accumulators of ReduceCols(): Identity() is the start value, Apply() adds an element (also to SIMD
+        // registers), Combine() merges the accumulators of two parts of the rows.
+        template<typename _Op>
+        struct AccumulateSum
+        {
+            template<typename _Type> static _Type Identity(void) { return _Type(0); }
+            template<typename _Type> static _Type Apply(const _Type sum, const _Type x) { return sum + _Op::Apply(x); }
+            template<typename _Type> static _Type Combine(const _Type a, const _Type b) { return a + b; }
+#ifdef _MATRIX_SIMD
+            static SimdFloat Apply(const SimdFloat sum, const SimdFloat x) { return _Op::Accumulate(sum, x); }
+            static SimdDouble Apply(const SimdDouble sum, const SimdDouble x) { return _Op::Accumulate(sum, x); }
+#endif // _MATRIX_SIMD
+        };
+
+        template<typename _Cmp>
+        struct AccumulateExtreme : _Cmp
+        {
+            template<typename _Type> static _Type Combine(const _Type a, const _Type b) { return _Cmp::Apply(a, b); }
+        };
+
+        // acc[j] = apply(acc[j], a[row * stride + j]) for [rows] rows of [count] elements
+        template<typename _Acc, typename _Calc, typename _Elem>
+        inline void AccumulateRows(_Calc* acc, const _Elem* a, const size_t rows, const size_t count, const size_t stride, std::false_type)
+        {
+            for (size_t row = 0; row < rows; row++)
+            {
+                const _Elem* a_row = a + (row * stride);
+                for (size_t j = 0; j < count; j++)
+                    acc[j] = _Acc::Apply(acc[j], _Calc(a_row[j]));
+            }
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Acc, typename _Calc, typename _Elem>
+        inline void AccumulateRows(_Calc* acc, const _Elem* a, const size_t rows, const size_t count, const size_t stride, std::true_type)
+        {
+            typedef SimdLane<_Calc> _Lane;
+            constexpr size_t c_lanes = _Lane::c_lanes;
+
+            const size_t vector_end = count - (count % c_lanes);
+            for (size_t row = 0; row < rows; row++)
+            {
+                const _Elem* a_row = a + (row * stride);
+                for (size_t j = 0; j < vector_end; j += c_lanes)
+                    _Lane::Store(acc + j, _Acc::Apply(_Lane::Load(acc + j), _Lane::Load(a_row + j)));
+                for (size_t j = vector_end; j < count; j++)
+                    acc[j] = _Acc::Apply(acc[j], _Calc(a_row[j]));
+            }
+        }
+#endif // _MATRIX_SIMD
+
+        // acc[col] = reduction of the column of a [rows] x [cols] matrix. The matrix is read row by row in strips of
+        // columns whose accumulators stay in the L1 cache. Large matrices are split into parts of rows with their
+        // own accumulators, which are combined in order afterwards.
+        template<typename _Acc, typename _Calc, typename _Elem>
+        inline void AccumulateCols(_Calc* acc, const _Elem* a, const size_t rows, const size_t cols)
+        {
+            typedef std::integral_constant<bool, FusedSimd<_Calc, _Calc, _Elem>::c_value> _Simd;
+            constexpr size_t c_strip = std::max<size_t>(4096 / sizeof(_Calc), 1);
+
+            const size_t part_rows = std::max<size_t>(ParallelChunk<_Elem>(rows * cols) / std::max<size_t>(cols, 1), 1);
+            const size_t parts = (rows + part_rows - 1) / part_rows;
+
+            std::vector<_Calc> partial((parts - 1) * cols, _Acc::template Identity<_Calc>());
+            std::fill(acc, acc + cols, _Acc::template Identity<_Calc>());
+
+            ParallelFor(parts, 1, [=, &partial](const size_t begin, const size_t end)
+                {
+                    for (size_t part = begin; part < end; part++)
+                    {
+                        _Calc* part_acc = (part == 0) ? acc : &partial[(part - 1) * cols];
+                        const size_t row = part * part_rows;
+                        const size_t count = std::min(part_rows, rows - row);
+
+                        for (size_t col = 0; col < cols; col += c_strip)
+                            AccumulateRows<_Acc>(part_acc + col, a + (row * cols) + col, count, std::min(c_strip, cols - col), cols, _Simd());
+                    }
+                });
+
+            for (size_t part = 1; part < parts; part++)
+                for (size_t col = 0; col < cols; col++)
+                    acc[col] = _Acc::Combine(acc[col], partial[((part - 1) * cols) + col]);
+        }
+
+        // out[row] = func(a + row * cols) for all rows, large matrices are split across the threads
+        template<typename _Elem, typename _ElemOut, typename _Func>
+        inline void ReduceEachRow(const _Elem* a, _ElemOut* out, const size_t rows, const size_t cols, _Func func)
+        {
+            const size_t grain = std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1);
+
+            ParallelFor(rows, grain, [=](const size_t begin, const size_t end)
+                {
+                    for (size_t row = begin; row < end; row++)
+                        out[row] = _ElemOut(func(a + (row * cols)));
+                });
+        }
+
+        // The SIMD part of C = A op scalar, returns the number of processed elements
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseScalarSimd(const _ElemA*, const _ElemB, _ElemC*, const size_t, std::integral_constant<int, 0>)
+        {
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseScalarSimd(const _ElemA* a, const _ElemB b, _ElemC* c, const size_t count, std::integral_constant<int, 1>)
+        {
+            const SimdFloat value = SimdSetFloat(float(b));
+            const size_t end = count - (count % c_simd_floats);
+            for (size_t i = 0; i < end; i += c_simd_floats)
+                SimdStore<_ElemC>::Float(c + i, _Op::Apply(SimdLoad<_ElemA>::Float(a + i), value));
+            return end;
+        }
+
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline size_t ElementwiseScalarSimd(const _ElemA* a, const _ElemB b, _ElemC* c, const size_t count, std::integral_constant<int, 2>)
+        {
+            const SimdDouble value = SimdSetDouble(double(b));
+            const size_t end = count - (count % c_simd_doubles);
+            for (size_t i = 0; i < end; i += c_simd_doubles)
+                SimdStore<_ElemC>::Double(c + i, _Op::Apply(SimdLoad<_ElemA>::Double(a + i), value));
+            return end;
+        }
+#endif // _MATRIX_SIMD
+
+        // C = A op B for a [rows] x [cols] matrix A and a column vector B, B(row) is applied to the whole row
+        template<typename _Op, typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void BroadcastCol(const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t rows, const size_t cols)
+        {
+            typedef std::integral_constant<int, SimdPath<_ElemA, _ElemB, _ElemC>::c_value> _Path;
+
+            ParallelElements<_ElemC>(rows * cols, [=](const size_t begin, const size_t end)
+                {
+                    for (size_t i = begin; i < end;)
+                    {
+                        const _ElemB value = b[i / cols];
+                        const size_t row_end = std::min(((i / cols) + 1) * cols, end);
+
+                        for (i += ElementwiseScalarSimd<_Op>(a + i, value, c + i, row_end - i, _Path()); i < row_end; i++)
+                            c[i] = _ElemC(_Op::Apply(a[i], value));
+                    }
+                });
+        }
+
+        // The check of ApproxEqual(): equal values (also infinities) always pass, everything else has to be finite
+        // and within the tolerance
+        template<typename _Calc>
+        inline bool ApproxEqualRange(const _Calc* a, const _Calc* b, const size_t count, const _Calc abs_tolerance, const _Calc rel_tolerance, std::false_type)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (a[i] == b[i])
+                    continue;
+
+                const _Calc diff = std::abs(a[i] - b[i]);
+                if (not (diff <= std::max(abs_tolerance, rel_tolerance * std::max(std::abs(a[i]), std::abs(b[i])))) or std::isinf(diff))
+                    return false;
+            }
+            return true;
+        }
+
+        template<typename _Calc, typename _ElemA, typename _ElemB>
+        inline bool ApproxEqualRange(const _ElemA* a, const _ElemB* b, const size_t count, const _Calc abs_tolerance, const _Calc rel_tolerance, std::false_type)
+        {
+            constexpr size_t c_block = 64;
+            _Calc block_a[c_block], block_b[c_block];
+
+            for (size_t i = 0; i < count; i += c_block)
+            {
+                const size_t block = std::min(c_block, count - i);
+                std::copy(a + i, a + i + block, block_a);
+                std::copy(b + i, b + i + block, block_b);
+                if (not ApproxEqualRange(block_a, block_b, block, abs_tolerance, rel_tolerance, std::false_type()))
+                    return false;
+            }
+            return true;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Calc>
+        inline bool ApproxEqualRange(const _Calc* a, const _Calc* b, const size_t count, const _Calc abs_tolerance, const _Calc rel_tolerance, std::true_type)
+        {
+            typedef SimdLane<_Calc> _Lane;
+            typedef typename _Lane::_V _V;
+            constexpr size_t c_lanes = _Lane::c_lanes;
+
+            const _V sign = _Lane::Set(-0.0), inf = _Lane::Set(std::numeric_limits<double>::infinity());
+            const _V abs_tol = _Lane::Set(double(abs_tolerance)), rel_tol = _Lane::Set(double(rel_tolerance));
+
+            const size_t vector_end = count - (count % c_lanes);
+            for (size_t i = 0; i < vector_end; i += c_lanes)
+            {
+                const _V va = _Lane::Load(a + i), vb = _Lane::Load(b + i);
+                const _V diff = SimdAndNot(sign, SimdSub(va, vb));
+                const _V tolerance = SimdMax(abs_tol, SimdMul(rel_tol, SimdMax(SimdAndNot(sign, va), SimdAndNot(sign, vb))));
+                const _V unequal = SimdOr(SimdNotGreaterEqual(tolerance, diff), SimdEqual(diff, inf));
+
+                if (SimdAny(SimdAndNot(SimdEqual(va, vb), unequal)))
+                    return false;
+            }
+
+            return ApproxEqualRange(a + vector_end, b + vector_end, count - vector_end, abs_tolerance, rel_tolerance, std::false_type());
+        }
+#endif // _MATRIX_SIMD
+
+        // The unsigned integer with the bits of a floating point number
+        template<typename _Float>
+        using UlpBits = typename std::conditional<sizeof(_Float) == 4, uint32_t, uint64_t>::type;
+
+        // true if a and b are at most max_ulps floating point numbers apart. Numbers with different signs are
+        // counted through 0, so 0.0 and -0.0 are equal.
+        template<typename _Float>
+        inline bool UlpsWithin(const _Float a, const _Float b, const UlpBits<_Float> max_ulps)
+        {
+            typedef UlpBits<_Float> _Bits;
+            constexpr _Bits c_sign = _Bits(1) << ((sizeof(_Bits) * 8) - 1);
+
+            const _Float inf = std::numeric_limits<_Float>::infinity();
+            _Bits bits_a, bits_b, bits_inf;
+            memcpy(&bits_a, &a, sizeof(_Bits));
+            memcpy(&bits_b, &b, sizeof(_Bits));
+            memcpy(&bits_inf, &inf, sizeof(_Bits));
+
+            const _Bits magnitude_a = bits_a & ~c_sign, magnitude_b = bits_b & ~c_sign;
+            if (magnitude_a > bits_inf or magnitude_b > bits_inf)
+                return false;
+
+            if ((bits_a ^ bits_b) & c_sign)
+                return magnitude_a <= max_ulps and magnitude_b <= max_ulps - magnitude_a;
+
+            return ((magnitude_a > magnitude_b) ? magnitude_a - magnitude_b : magnitude_b - magnitude_a) <= max_ulps;
+        }
+
+        template<typename _Float>
+        inline bool ApproxEqualUlpsRange(const _Float* a, const _Float* b, const size_t count, const UlpBits<_Float> max_ulps)
+        {
+            for (size_t i = 0; i < count; i++)
+                if (not UlpsWithin(a[i], b[i], max_ulps))
+                    return false;
+            return true;
+        }
+
+#ifdef _MATRIX_SIMD_AVX2
+        // The distance in ULPs needs 64 bit integer comparisons, which SSE2 doesn't have. [max_ulps] is at most
+        // 2^30 (float) or 2^62 (double), so the sum of two magnitudes which are both within it can't overflow.
+        inline __m256i UlpsExceeded(const __m256i a, const __m256i b, const __m256i max_ulps, std::integral_constant<size_t, 4>)
+        {
+            const __m256i magnitude = _mm256_set1_epi32(0x7FFFFFFF), inf = _mm256_set1_epi32(0x7F800000);
+            const __m256i magnitude_a = _mm256_and_si256(a, magnitude), magnitude_b = _mm256_and_si256(b, magnitude);
+            const __m256i diff = _mm256_sub_epi32(magnitude_a, magnitude_b);
+
+            const __m256i nan = _mm256_or_si256(_mm256_cmpgt_epi32(magnitude_a, inf), _mm256_cmpgt_epi32(magnitude_b, inf));
+            const __m256i same_sign = _mm256_or_si256(_mm256_cmpgt_epi32(diff, max_ulps), _mm256_cmpgt_epi32(_mm256_sub_epi32(_mm256_setzero_si256(), diff), max_ulps));
+            const __m256i other_sign = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(magnitude_a, max_ulps), _mm256_cmpgt_epi32(magnitude_b, max_ulps)),
+                _mm256_cmpgt_epi32(_mm256_add_epi32(magnitude_a, magnitude_b), max_ulps));
+
+            return _mm256_or_si256(nan, _mm256_blendv_epi8(same_sign, other_sign, _mm256_srai_epi32(_mm256_xor_si256(a, b), 31)));
+        }
+
+        inline __m256i UlpsExceeded(const __m256i a, const __m256i b, const __m256i max_ulps, std::integral_constant<size_t, 8>)
+        {
+            const __m256i magnitude = _mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL), inf = _mm256_set1_epi64x(0x7FF0000000000000LL);
+            const __m256i magnitude_a = _mm256_and_si256(a, magnitude), magnitude_b = _mm256_and_si256(b, magnitude);
+            const __m256i diff = _mm256_sub_epi64(magnitude_a, magnitude_b);
+
+            const __m256i nan = _mm256_or_si256(_mm256_cmpgt_epi64(magnitude_a, inf), _mm256_cmpgt_epi64(magnitude_b, inf));
+            const __m256i same_sign = _mm256_or_si256(_mm256_cmpgt_epi64(diff, max_ulps), _mm256_cmpgt_epi64(_mm256_sub_epi64(_mm256_setzero_si256(), diff), max_ulps));
+            const __m256i other_sign = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi64(magnitude_a, max_ulps), _mm256_cmpgt_epi64(magnitude_b, max_ulps)),
+                _mm256_cmpgt_epi64(_mm256_add_epi64(magnitude_a, magnitude_b), max_ulps));
+
+            return _mm256_or_si256(nan, _mm256_blendv_epi8(same_sign, other_sign, _mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_xor_si256(a, b))));
+        }
+
+        template<typename _Float>
+        inline bool ApproxEqualUlpsSimd(const _Float* a, const _Float* b, const size_t count, const UlpBits<_Float> max_ulps)
+        {
+            constexpr size_t c_lanes = 32 / sizeof(_Float);
+            const __m256i ulps = (sizeof(_Float) == 4) ? _mm256_set1_epi32(int32_t(max_ulps)) : _mm256_set1_epi64x(int64_t(max_ulps));
+
+            const size_t vector_end = count - (count % c_lanes);
+            for (size_t i = 0; i < vector_end; i += c_lanes)
+            {
+                const __m256i exceeded = UlpsExceeded(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)), ulps,
+                    std::integral_constant<size_t, sizeof(_Float)>());
+                if (not _mm256_testz_si256(exceeded, exceeded))
+                    return false;
+            }
+
+            return ApproxEqualUlpsRange(a + vector_end, b + vector_end, count - vector_end, max_ulps);
+        }
+#endif // _MATRIX_SIMD_AVX2
+
+        // XXH64 by Yann Collet, reads the bytes with memcpy, so [p] doesn't need to be aligned
+        struct XXH64
+        {
+            static constexpr uint64_t c_prime1 = 0x9E3779B185EBCA87ULL;
+            static constexpr uint64_t c_prime2 = 0xC2B2AE3D27D4EB4FULL;
+            static constexpr uint64_t c_prime3 = 0x165667B19E3779F9ULL;
+            static constexpr uint64_t c_prime4 = 0x85EBCA77C2B2AE63ULL;
+            static constexpr uint64_t c_prime5 = 0x27D4EB2F165667C5ULL;
+
+            static uint64_t Rotl(const uint64_t x, const int bits) { return (x << bits) | (x >> (64 - bits)); }
+            static uint64_t Read64(const unsigned char* p) { uint64_t v; memcpy(&v, p, 8); return v; }
+            static uint32_t Read32(const unsigned char* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+
+            static uint64_t Round(const uint64_t acc, const uint64_t input) { return Rotl(acc + (input * c_prime2), 31) * c_prime1; }
+            static uint64_t Merge(const uint64_t acc, const uint64_t value) { return ((acc ^ Round(0, value)) * c_prime1) + c_prime4; }
+
+            static uint64_t Hash(const unsigned char* p, const size_t length, const uint64_t seed)
+            {
+                const unsigned char* const end = p + length;
+                uint64_t h;
+
+                if (length >= 32)
+                {
+                    // four independent lanes keep the multipliers busy
+                    uint64_t v1 = seed + c_prime1 + c_prime2, v2 = seed + c_prime2, v3 = seed, v4 = seed - c_prime1;
+                    for (; p + 32 <= end; p += 32)
+                    {
+                        v1 = Round(v1, Read64(p));
+                        v2 = Round(v2, Read64(p + 8));
+                        v3 = Round(v3, Read64(p + 16));
+                        v4 = Round(v4, Read64(p + 24));
+                    }
+
+                    h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+                    h = Merge(h, v1);
+                    h = Merge(h, v2);
+                    h = Merge(h, v3);
+                    h = Merge(h, v4);
+                }
+                else
+                    h = seed + c_prime5;
+
+                h += uint64_t(length);
+
+                for (; p + 8 <= end; p += 8)
+                    h = (Rotl(h ^ Round(0, Read64(p)), 27) * c_prime1) + c_prime4;
+                for (; p + 4 <= end; p += 4)
+                    h = (Rotl(h ^ (uint64_t(Read32(p)) * c_prime1), 23) * c_prime2) + c_prime3;
+                for (; p < end; p++)
+                    h = Rotl(h ^ (uint64_t(*p) * c_prime5), 11) * c_prime1;
+
+                h ^= h >> 33;
+                h *= c_prime2;
+                h ^= h >> 29;
+                h *= c_prime3;
+                h ^= h >> 32;
+                return h;
+            }
+        };
+
+        inline size_t PopCount(const uint64_t x)
+        {
+#if defined(__GNUC__)
+            return size_t(__builtin_popcountll(x));
+#else
+            uint64_t v = x - ((x >> 1) & 0x5555555555555555ULL);
+            v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return size_t((v * 0x0101010101010101ULL) >> 56);
+#endif // defined(__GNUC__)
+        }
+
+        // the index of the lowest set bit, x must not be 0
+        inline size_t TrailingZeros(const uint64_t x)
+        {
+#if defined(__GNUC__)
+            return size_t(__builtin_ctzll(x));
+#else
+            return PopCount((x & (~x + 1)) - 1);
+#endif // defined(__GNUC__)
+        }
+
+        // The comparisons of Compare() on scalars and SIMD registers
+        struct CmpLess
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a < b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdLess(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct CmpLessEqual
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a <= b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdLessEqual(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct CmpGreater
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a > b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdLess(b, a); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct CmpGreaterEqual
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a >= b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdLessEqual(b, a); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct CmpEqual
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a == b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdEqual(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        struct CmpNotEqual
+        {
+            template<typename _Type> static bool Apply(const _Type a, const _Type b) { return a != b; }
+#ifdef _MATRIX_SIMD
+            template<typename _V> static _V Mask(const _V a, const _V b) { return SimdNotEqual(a, b); }
+#endif // _MATRIX_SIMD
+        };
+
+        // The bits of up to 64 comparisons a[j] cmp b[j], calculated in _Calc
+        template<typename _Cmp, typename _Calc, typename _ElemA, typename _ElemB>
+        inline uint64_t CompareWord(const _ElemA* a, const _ElemB* b, const size_t count, std::false_type)
+        {
+            uint64_t bits = 0;
+            for (size_t j = 0; j < count; j++)
+                bits |= uint64_t(_Cmp::Apply(_Calc(a[j]), _Calc(b[j]))) << j;
+            return bits;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Cmp, typename _Calc, typename _ElemA, typename _ElemB>
+        inline uint64_t CompareWord(const _ElemA* a, const _ElemB* b, const size_t count, std::true_type)
+        {
+            typedef SimdLane<_Calc> _Lane;
+
+            uint64_t bits = 0;
+            const size_t vector_end = count - (count % _Lane::c_lanes);
+            for (size_t j = 0; j < vector_end; j += _Lane::c_lanes)
+                bits |= uint64_t(SimdBits(_Cmp::Mask(_Lane::Load(a + j), _Lane::Load(b + j)))) << j;
+            if (vector_end < count)
+                bits |= CompareWord<_Cmp, _Calc>(a + vector_end, b + vector_end, count - vector_end, std::false_type()) << vector_end;
+            return bits;
+        }
+#endif // _MATRIX_SIMD
+
+        // Fills the words of a mask with a[i] cmp b[i] for [count] elements. [b_step] is the offset of b from one
+        // word to the next: 64 for a matrix, 0 for a block of 64 copies of a scalar.
+        template<typename _Cmp, typename _ElemA, typename _ElemB>
+        inline void CompareWords(uint64_t* words, const size_t count, const _ElemA* a, const _ElemB* b, const size_t b_step)
+        {
+            typedef decltype(std::declval<_ElemA>() + std::declval<_ElemB>()) _Calc;
+            typedef std::integral_constant<bool, FusedSimd<_Calc, _Calc, _ElemA, _ElemB>::c_value> _Simd;
+
+            const size_t word_count = (count + 63) / 64;
+            ParallelFor(word_count, std::max<size_t>(ParallelThreshold() / 64, 1), [=](const size_t begin, const size_t end)
+                {
+                    for (size_t word = begin; word < end; word++)
+                        words[word] = CompareWord<_Cmp, _Calc>(a + (word * 64), b + (word * b_step), std::min<size_t>(64, count - (word * 64)), _Simd());
+                });
+        }
+
+        template<typename _ElemA, typename _ElemB>
+        inline void CompareWords(uint64_t* words, const size_t count, const _ElemA* a, const _ElemB* b, const size_t b_step, const Comparison comparison)
+        {
+            switch (comparison)
+            {
+            case Comparison::Less:          CompareWords<CmpLess>(words, count, a, b, b_step); break;
+            case Comparison::LessEqual:     CompareWords<CmpLessEqual>(words, count, a, b, b_step); break;
+            case Comparison::Greater:       CompareWords<CmpGreater>(words, count, a, b, b_step); break;
+            case Comparison::GreaterEqual:  CompareWords<CmpGreaterEqual>(words, count, a, b, b_step); break;
+            case Comparison::Equal:         CompareWords<CmpEqual>(words, count, a, b, b_step); break;
+            default:                        CompareWords<CmpNotEqual>(words, count, a, b, b_step); break;
+            }
+        }
+
+        // a [comparison] s for a scalar s which _Calc can't represent, rewritten as a comparison with a neighbour
+        // of s in _Calc: a < s is a <= below, a > s is a >= above, and a == s is never true, like a == NaN.
+        template<typename _Calc, typename _Exact>
+        inline void NarrowComparison(const _Exact s, Comparison& comparison, _Calc& threshold, std::true_type)
+        {
+            const _Calc nearest = _Calc(s);
+            const _Calc below = (_Exact(nearest) < s) ? nearest : std::nextafter(nearest, -std::numeric_limits<_Calc>::infinity());
+            const _Calc above = (_Exact(nearest) > s) ? nearest : std::nextafter(nearest, std::numeric_limits<_Calc>::infinity());
+
+            switch (comparison)
+            {
+            case Comparison::Less:
+            case Comparison::LessEqual:     comparison = Comparison::LessEqual; threshold = below; break;
+            case Comparison::Greater:
+            case Comparison::GreaterEqual:  comparison = Comparison::GreaterEqual; threshold = above; break;
+            default:                        threshold = std::numeric_limits<_Calc>::quiet_NaN(); break;
+            }
+        }
+
+        template<typename _Calc, typename _Exact>
+        inline void NarrowComparison(const _Exact, Comparison&, _Calc&, std::false_type) {}
+
+        // c[j] = bit j ? a[j] : b[j] for up to 64 elements
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void SelectWord(const uint64_t bits, const _ElemA* a, const _ElemB* b, _ElemC* c, const size_t count, std::false_type)
+        {
+            for (size_t j = 0; j < count; j++)
+                c[j] = ((bits >> j) & 1) ? _ElemC(a[j]) : _ElemC(b[j]);
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Elem>
+        inline void SelectWord(const uint64_t bits, const _Elem* a, const _Elem* b, _Elem* c, const size_t count, std::true_type)
+        {
+            typedef SimdLane<_Elem> _Lane;
+            constexpr uint32_t c_lane_bits = (1u << _Lane::c_lanes) - 1;
+
+            const size_t vector_end = count - (count % _Lane::c_lanes);
+            for (size_t j = 0; j < vector_end; j += _Lane::c_lanes)
+                _Lane::Store(c + j, SimdSelect(_Lane::Mask(uint32_t(bits >> j) & c_lane_bits), _Lane::Load(a + j), _Lane::Load(b + j)));
+            if (vector_end < count)
+                SelectWord(bits >> vector_end, a + vector_end, b + vector_end, c + vector_end, count - vector_end, std::false_type());
+        }
+#endif // _MATRIX_SIMD
+
+        // c[i] = mask[i] ? a[i] : b[i] for [count] elements. [a_step] is the offset of a from one word to the next,
+        // 0 for a block of 64 copies of a scalar. Words without a set bit are skipped if c is b (masked assignment).
+        template<typename _ElemA, typename _ElemB, typename _ElemC>
+        inline void Select(const uint64_t* words, const size_t count, const _ElemA* a, const size_t a_step, const _ElemB* b, _ElemC* c)
+        {
+            typedef std::integral_constant<bool, FusedSimd<_ElemC, _ElemC, _ElemA, _ElemB>::c_value> _Simd;
+
+            const bool in_place = (static_cast<const void*>(b) == static_cast<const void*>(c));
+            const size_t word_count = (count + 63) / 64;
+            ParallelFor(word_count, std::max<size_t>(ParallelThreshold() / 64, 1), [=](const size_t begin, const size_t end)
+                {
+                    for (size_t word = begin; word < end; word++)
+                    {
+                        if (in_place and words[word] == 0)
+                            continue;
+
+                        const size_t i = word * 64;
+                        SelectWord(words[word], a + (word * a_step), b + i, c + i, std::min<size_t>(64, count - i), _Simd());
+                    }
+                });
+        }
+
+        // The edge of the square tiles of TransposeStrided(): one cache line per tile row. Larger tiles don't fit
+        // into the few ways of the L1 cache that rows with a power of two stride map to.
+        template<typename _Elem>
+        constexpr size_t TransposeTile(void) { return std::max<size_t>(64 / sizeof(_Elem), 8); }
+
+        // b[j * b_stride + i] = a[i * a_stride + j] for [rows] x [cols] elements
+        template<typename _ElemA, typename _ElemB>
+        inline void TransposeBlock(const _ElemA* a, const ptrdiff_t a_stride, _ElemB* b, const ptrdiff_t b_stride, const size_t rows, const size_t cols, std::false_type)
+        {
+            for (size_t j = 0; j < cols; j++)
+                for (size_t i = 0; i < rows; i++)
+                    b[(ptrdiff_t(j) * b_stride) + ptrdiff_t(i)] = _ElemB(a[(ptrdiff_t(i) * a_stride) + ptrdiff_t(j)]);
+        }
+
+#ifdef _MATRIX_SIMD
+        // Transposes one block of lanes x lanes elements in registers
+#ifdef _MATRIX_SIMD_AVX2
+        inline void SimdTranspose(const float* a, const ptrdiff_t a_stride, float* b, const ptrdiff_t b_stride)
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(a + a_stride));
+            const __m256 t1 = _mm256_unpackhi_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(a + a_stride));
+            const __m256 t2 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + (2 * a_stride)), _mm256_loadu_ps(a + (3 * a_stride)));
+            const __m256 t3 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + (2 * a_stride)), _mm256_loadu_ps(a + (3 * a_stride)));
+            const __m256 t4 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + (4 * a_stride)), _mm256_loadu_ps(a + (5 * a_stride)));
+            const __m256 t5 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + (4 * a_stride)), _mm256_loadu_ps(a + (5 * a_stride)));
+            const __m256 t6 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + (6 * a_stride)), _mm256_loadu_ps(a + (7 * a_stride)));
+            const __m256 t7 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + (6 * a_stride)), _mm256_loadu_ps(a + (7 * a_stride)));
+
+            const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+            _mm256_storeu_ps(b, _mm256_permute2f128_ps(s0, s4, 0x20));
+            _mm256_storeu_ps(b + b_stride, _mm256_permute2f128_ps(s1, s5, 0x20));
+            _mm256_storeu_ps(b + (2 * b_stride), _mm256_permute2f128_ps(s2, s6, 0x20));
+            _mm256_storeu_ps(b + (3 * b_stride), _mm256_permute2f128_ps(s3, s7, 0x20));
+            _mm256_storeu_ps(b + (4 * b_stride), _mm256_permute2f128_ps(s0, s4, 0x31));
+            _mm256_storeu_ps(b + (5 * b_stride), _mm256_permute2f128_ps(s1, s5, 0x31));
+            _mm256_storeu_ps(b + (6 * b_stride), _mm256_permute2f128_ps(s2, s6, 0x31));
+            _mm256_storeu_ps(b + (7 * b_stride), _mm256_permute2f128_ps(s3, s7, 0x31));
+        }
+
+        inline void SimdTranspose(const double* a, const ptrdiff_t a_stride, double* b, const ptrdiff_t b_stride)
+        {
+            const __m256d t0 = _mm256_unpacklo_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(a + a_stride));
+            const __m256d t1 = _mm256_unpackhi_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(a + a_stride));
+            const __m256d t2 = _mm256_unpacklo_pd(_mm256_loadu_pd(a + (2 * a_stride)), _mm256_loadu_pd(a + (3 * a_stride)));
+            const __m256d t3 = _mm256_unpackhi_pd(_mm256_loadu_pd(a + (2 * a_stride)), _mm256_loadu_pd(a + (3 * a_stride)));
+
+            _mm256_storeu_pd(b, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(b + b_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(b + (2 * b_stride), _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(b + (3 * b_stride), _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+#else
+        inline void SimdTranspose(const float* a, const ptrdiff_t a_stride, float* b, const ptrdiff_t b_stride)
+        {
+            __m128 r0 = _mm_loadu_ps(a);
+            __m128 r1 = _mm_loadu_ps(a + a_stride);
+            __m128 r2 = _mm_loadu_ps(a + (2 * a_stride));
+            __m128 r3 = _mm_loadu_ps(a + (3 * a_stride));
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(b, r0);
+            _mm_storeu_ps(b + b_stride, r1);
+            _mm_storeu_ps(b + (2 * b_stride), r2);
+            _mm_storeu_ps(b + (3 * b_stride), r3);
+        }
+
+        inline void SimdTranspose(const double* a, const ptrdiff_t a_stride, double* b, const ptrdiff_t b_stride)
+        {
+            const __m128d r0 = _mm_loadu_pd(a);
+            const __m128d r1 = _mm_loadu_pd(a + a_stride);
+            _mm_storeu_pd(b, _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(b + b_stride, _mm_unpackhi_pd(r0, r1));
+        }
+#endif // _MATRIX_SIMD_AVX2
+
+        template<typename _Elem>
+        inline void TransposeBlock(const _Elem* a, const ptrdiff_t a_stride, _Elem* b, const ptrdiff_t b_stride, const size_t rows, const size_t cols, std::true_type)
+        {
+            // only moves bits, so every 4 or 8 byte type uses the float or double registers
+            typedef typename std::conditional<sizeof(_Elem) == 4, float, double>::type _Lanes;
+            const size_t lanes = SimdLane<_Lanes>::c_lanes;
+            const _Lanes* src = reinterpret_cast<const _Lanes*>(a);
+            _Lanes* dst = reinterpret_cast<_Lanes*>(b);
+
+            const size_t row_end = rows - (rows % lanes);
+            const size_t col_end = cols - (cols % lanes);
+            for (size_t i = 0; i < row_end; i += lanes)
+                for (size_t j = 0; j < col_end; j += lanes)
+                    SimdTranspose(src + (ptrdiff_t(i) * a_stride) + ptrdiff_t(j), a_stride, dst + (ptrdiff_t(j) * b_stride) + ptrdiff_t(i), b_stride);
+
+            // the right and the bottom edge
+            TransposeBlock(a + col_end, a_stride, b + (ptrdiff_t(col_end) * b_stride), b_stride, rows, cols - col_end, std::false_type());
+            TransposeBlock(a + (ptrdiff_t(row_end) * a_stride), a_stride, b + row_end, b_stride, rows - row_end, col_end, std::false_type());
+        }
+#endif // _MATRIX_SIMD
+
+        // Whether TransposeBlock() moves [_ElemA] to [_ElemB] in SIMD registers
+        template<typename _ElemA, typename _ElemB>
+        struct TransposeSimd
+        {
+#ifdef _MATRIX_SIMD
+            const static bool c_value = std::is_same<_ElemA, _ElemB>::value and std::is_trivially_copyable<_ElemA>::value and
+                (sizeof(_ElemA) == 4 or sizeof(_ElemA) == 8);
+#else
+            const static bool c_value = false;
+#endif // _MATRIX_SIMD
+        };
+
+        // b[j * b_stride + i] = a[i * a_stride + j] for a [rows] x [cols] source. A negative stride walks the rows
+        // backwards, which turns the transpose into a rotation. The source is processed in square tiles, so the
+        // strided side stays in the cache, and the threads get whole columns of tiles, i.e. contiguous rows of b.
+        template<typename _ElemA, typename _ElemB>
+        inline void TransposeStrided(const _ElemA* a, const ptrdiff_t a_stride, _ElemB* b, const ptrdiff_t b_stride, const size_t rows, const size_t cols)
+        {
+            typedef std::integral_constant<bool, TransposeSimd<_ElemA, _ElemB>::c_value> _Simd;
+            const size_t tile = TransposeTile<_ElemB>();
+
+            const size_t col_tiles = (cols + tile - 1) / tile;
+            const size_t grain = std::max<size_t>(ParallelThreshold() / std::max<size_t>(rows * tile, 1), 1);
+            ParallelFor(col_tiles, grain, [=](const size_t begin, const size_t end)
+                {
+                    for (size_t col_tile = begin; col_tile < end; col_tile++)
+                    {
+                        const size_t j = col_tile * tile;
+                        const size_t tile_cols = std::min(tile, cols - j);
+
+                        for (size_t i = 0; i < rows; i += tile)
+                            TransposeBlock(a + (ptrdiff_t(i) * a_stride) + ptrdiff_t(j), a_stride, b + (ptrdiff_t(j) * b_stride) + ptrdiff_t(i), b_stride,
+                                std::min(tile, rows - i), tile_cols, _Simd());
+                    }
+                });
+        }
+
+        // swaps p[i] and p[count - 1 - i] for i in [begin, end), end must not be above count / 2
+        template<typename _Elem>
+        inline void ReverseSwap(_Elem* p, const size_t count, const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                std::swap(p[i], p[count - 1 - i]);
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _Elem>
+        inline void ReverseSwapSimd(_Elem* p, const size_t count, const size_t begin, const size_t end)
+        {
+            typedef SimdLane<_Elem> _Lane;
+
+            const size_t vector_end = end - ((end - begin) % _Lane::c_lanes);
+            for (size_t i = begin; i < vector_end; i += _Lane::c_lanes)
+            {
+                _Elem* back = p + (count - i - _Lane::c_lanes);
+                const typename _Lane::_V front = _Lane::Load(p + i);
+                _Lane::Store(p + i, SimdReverse(_Lane::Load(back)));
+                _Lane::Store(back, SimdReverse(front));
+            }
+            for (size_t i = vector_end; i < end; i++)
+                std::swap(p[i], p[count - 1 - i]);
+        }
+
+        inline void ReverseSwap(float* p, const size_t count, const size_t begin, const size_t end) { ReverseSwapSimd(p, count, begin, end); }
+        inline void ReverseSwap(double* p, const size_t count, const size_t begin, const size_t end) { ReverseSwapSimd(p, count, begin, end); }
+#endif // _MATRIX_SIMD
+
+        // reverses the order of [count] elements in place
+        template<typename _Elem>
+        inline void ReverseInPlace(_Elem* p, const size_t count)
+        {
+            ParallelElements<_Elem>(count / 2, [=](const size_t begin, const size_t end) { ReverseSwap(p, count, begin, end); });
+        }
+
+        // reverses the elements of every row in place
+        template<typename _Elem>
+        inline void ReverseEachRow(_Elem* p, const size_t rows, const size_t cols)
+        {
+            ParallelFor(rows, std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    for (size_t row = begin; row < end; row++)
+                        ReverseSwap(p + (row * cols), cols, 0, cols / 2);
+                });
+        }
+
+        // reverses the order of the rows in place
+        template<typename _Elem>
+        inline void ReverseRowOrder(_Elem* p, const size_t rows, const size_t cols)
+        {
+            ParallelFor(rows / 2, std::max<size_t>(ParallelThreshold() / std::max<size_t>(2 * cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    for (size_t row = begin; row < end; row++)
+                        std::swap_ranges(p + (row * cols), p + ((row + 1) * cols), p + ((rows - 1 - row) * cols));
+                });
+        }
+
+        // In-place transpose of a square matrix: the tile (i, j) is transposed into a buffer, the tile (j, i) is
+        // transposed into its place and the buffer is copied to (j, i). Tile row p is paired with the tile row
+        // (tiles - 1 - p), so every pair covers the same number of tiles of the upper triangle.
+        template<typename _Elem>
+        inline void TransposeSquareInPlace(_Elem* a, const size_t size)
+        {
+            typedef std::integral_constant<bool, TransposeSimd<_Elem, _Elem>::c_value> _Simd;
+            const size_t tile = TransposeTile<_Elem>();
+            const size_t tiles = (size + tile - 1) / tile;
+            const ptrdiff_t stride = ptrdiff_t(size);
+
+            const size_t grain = std::max<size_t>(ParallelThreshold() / std::max<size_t>(2 * tile * size, 1), 1);
+            ParallelFor((tiles + 1) / 2, grain, [=](const size_t begin, const size_t end)
+                {
+                    std::vector<_Elem> buffer(tile * tile);
+
+                    auto tile_row = [&](const size_t tile_i)
+                    {
+                        const size_t i = tile_i * tile;
+                        const size_t height = std::min(tile, size - i);
+
+                        for (size_t j = i; j < size; j += tile)
+                        {
+                            const size_t width = std::min(tile, size - j);
+                            _Elem* upper = a + (i * size) + j;
+                            _Elem* lower = a + (j * size) + i;
+
+                            TransposeBlock(upper, stride, buffer.data(), ptrdiff_t(tile), height, width, _Simd());
+                            if (upper != lower)
+                                TransposeBlock(lower, stride, upper, stride, width, height, _Simd());
+                            for (size_t row = 0; row < width; row++)
+                                std::copy(buffer.data() + (row * tile), buffer.data() + (row * tile) + height, lower + (row * size));
+                        }
+                    };
+
+                    for (size_t pair = begin; pair < end; pair++)
+                    {
+                        tile_row(pair);
+                        if (tiles - 1 - pair != pair)
+                            tile_row(tiles - 1 - pair);
+                    }
+                });
+        }
+
+        // In-place transpose of a [rows] x [cols] matrix by following the cycles of the permutation: position k gets
+        // the element from (k * cols) mod (count - 1). The bitset marks the positions which already have their element.
+        template<typename _Elem>
+        inline void TransposeCycles(_Elem* a, const size_t rows, const size_t cols)
+        {
+            if (rows <= 1 or cols <= 1)
+                return;
+
+            const size_t last = (rows * cols) - 1;
+            std::vector<uint64_t> visited((last + 64) / 64, 0);
+
+            for (size_t start = 1; start < last; start++)
+            {
+                if (visited[start / 64] == ~uint64_t(0))
+                {
+                    start |= 63;
+                    continue;
+                }
+                if ((visited[start / 64] >> (start % 64)) & 1)
+                    continue;
+
+                _Elem first = std::move(a[start]);
+                size_t position = start;
+                while (true)
+                {
+                    visited[position / 64] |= uint64_t(1) << (position % 64);
+
+                    const size_t source = (position * cols) % last;
+                    if (source == start)
+                        break;
+
+                    a[position] = std::move(a[source]);
+                    position = source;
+                }
+                a[position] = std::move(first);
+            }
+        }
+
+        // a^T in place, square matrices are transposed tile by tile
+        template<typename _Elem>
+        inline void TransposeInPlace(_Elem* a, const size_t rows, const size_t cols)
+        {
+            if (rows == cols)
+                TransposeSquareInPlace(a, rows);
+            else
+                TransposeCycles(a, rows, cols);
+        }
+
+        // b[i] = _ElemB(a[i]) for [count] elements
+        template<typename _ElemA, typename _ElemB>
+        inline void CopyRow(const _ElemA* a, _ElemB* b, const size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+                b[i] = _ElemB(a[i]);
+        }
+
+        template<typename _Elem>
+        inline void CopyRow(const _Elem* a, _Elem* b, const size_t count)
+        {
+            std::copy(a, a + count, b);
+        }
+
+        // b[row * cols + col] = a[row * row_stride + col * col_stride]. Rows and columns which are contiguous in the
+        // source are copied row by row, sources with contiguous columns go through the blocked transpose.
+        template<typename _ElemA, typename _ElemB>
+        inline void CopyStrided(const _ElemA* a, const ptrdiff_t row_stride, const ptrdiff_t col_stride, _ElemB* b, const size_t rows, const size_t cols)
+        {
+            if (rows == 0 or cols == 0)
+                return;
+
+            if (col_stride == 1 or col_stride == -1)
+            {
+                ParallelFor(rows, std::max<size_t>(ParallelThreshold() / cols, 1), [=](const size_t begin, const size_t end)
+                    {
+                        for (size_t row = begin; row < end; row++)
+                        {
+                            const _ElemA* src = a + (ptrdiff_t(row) * row_stride);
+                            if (col_stride == 1)
+                                CopyRow(src, b + (row * cols), cols);
+                            else
+                                ReverseRange(src + 1, b + (row * cols), cols, false);
+                        }
+                    });
+            }
+            else if (row_stride == 1)
+                TransposeStrided(a, col_stride, b, ptrdiff_t(cols), cols, rows);
+            else if (row_stride == -1)
+                TransposeStrided(a - (rows - 1), col_stride, b + ((rows - 1) * cols), -ptrdiff_t(cols), cols, rows);
+            else
+            {
+                for (size_t row = 0; row < rows; row++)
+                    for (size_t col = 0; col < cols; col++)
+                        b[(row * cols) + col] = _ElemB(a[(ptrdiff_t(row) * row_stride) + (ptrdiff_t(col) * col_stride)]);
+            }
+        }
+
+        // Copies a [rows] x [cols] block between two row-major matrices with the row lengths [lda] and [ldb]
+        template<typename _ElemA, typename _ElemB>
+        inline void CopyBlock(const _ElemA* a, const size_t lda, _ElemB* b, const size_t ldb, const size_t rows, const size_t cols)
+        {
+            if (lda == cols and ldb == cols)
+            {
+                ParallelElements<_ElemB>(rows * cols, [=](const size_t begin, const size_t end) { CopyRow(a + begin, b + begin, end - begin); });
+                return;
+            }
+
+            ParallelFor(rows, std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    for (size_t row = begin; row < end; row++)
+                        CopyRow(a + (row * lda), b + (row * ldb), cols);
+                });
+        }
+
+        // Copies [block] into the columns of C starting at [col0] and moves [col0] behind it
+        template<typename _ElemC, typename _ElemB, size_t _RowsB, size_t _ColsB>
+        inline void WriteHStackBlock(_ElemC* c, const size_t cols_c, Matrix2D<_ElemB, _RowsB, _ColsB>& block, size_t& col0)
+        {
+            CopyBlock(&block[0], _ColsB, c + col0, cols_c, _RowsB, _ColsB);
+            col0 += _ColsB;
+        }
+
+        // Copies [block] into the rows of C starting at [row0] and moves [row0] behind it
+        template<typename _ElemC, typename _ElemB, size_t _RowsB, size_t _ColsB>
+        inline void WriteVStackBlock(_ElemC* c, const size_t cols_c, Matrix2D<_ElemB, _RowsB, _ColsB>& block, size_t& row0)
+        {
+            CopyBlock(&block[0], _ColsB, c + (row0 * cols_c), cols_c, _RowsB, _ColsB);
+            row0 += _RowsB;
+        }
+
+        // How many rows ahead GatherRows() and the scatter functions prefetch the next indexed row
+        constexpr size_t c_prefetch_rows = 8;
+
+        // Asks the cache for the first lines of a row which is about to be read or written, the rest
+        // of a long row is picked up by the hardware prefetcher once the accesses run sequentially
+        template<typename _Elem>
+        inline void PrefetchRow(const _Elem* row, const size_t cols)
+        {
+            const char* bytes = reinterpret_cast<const char*>(row);
+            const size_t length = std::min<size_t>(cols * sizeof(_Elem), 256);
+
+            for (size_t offset = 0; offset < length; offset += 64)
+            {
+#if defined(_MATRIX_SIMD)
+                _mm_prefetch(bytes + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+                __builtin_prefetch(bytes + offset);
+#else
+                (void)bytes;
+#endif
+            }
+        }
+
+        // Calls func(target, source) for every source row i whose target row indices[i] lies in [begin, end).
+        // Each thread owns a range of target rows, so repeated indices never race and are applied in order.
+        template<typename _Index, typename _ElemA, typename _ElemB, typename _Func>
+        inline void ScatterRange(const _Index* indices, const size_t count, const _ElemA* a, _ElemB* b, const size_t cols, const size_t begin, const size_t end, _Func&& func)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (i + c_prefetch_rows < count)
+                {
+                    const size_t ahead = size_t(indices[i + c_prefetch_rows]);
+                    if (ahead >= begin and ahead < end)
+                    {
+                        PrefetchRow(a + ((i + c_prefetch_rows) * cols), cols);
+                        PrefetchRow(b + (ahead * cols), cols);
+                    }
+                }
+
+                const size_t target = size_t(indices[i]);
+                if (target >= begin and target < end)
+                    func(b + (target * cols), a + (i * cols));
+            }
+        }
+
+        // Warns about the first index outside [0, rows) in debug builds, negative indices wrap around to huge
+        // unsigned values. GatherRows() and the scatter functions skip such rows in every build.
+        template<typename _Index>
+        inline void CheckRowIndices(const _Index* indices, const size_t count, const size_t rows, const char* function)
+        {
+#ifndef NDEBUG
+            for (size_t i = 0; i < count; i++)
+            {
+                if (size_t(indices[i]) >= rows)
+                {
+                    std::cerr << "MATRIX WARNING: " << function << " got the row index " << +indices[i] << " at position " << i
+                        << ", but the matrix only has " << rows << " rows. Rows with invalid indices are skipped!" << std::endl;
+                    return;
+                }
+            }
+#else
+            (void)indices; (void)count; (void)rows; (void)function;
+#endif // !NDEBUG
+        }
+
+        template<typename _Index, typename _ElemA, typename _ElemB, typename _Func>
+        inline void Scatter(const _Index* indices, const size_t count, const _ElemA* a, _ElemB* b, const size_t rows_b, const size_t cols, _Func&& func)
+        {
+            // every thread scans all indices, so the rows are only split when each range still copies enough
+            const size_t grain = std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1) * std::max<size_t>(rows_b / std::max<size_t>(count, 1), 1);
+
+            ParallelFor(rows_b, grain, [=, &func](const size_t begin, const size_t end)
+                { ScatterRange(indices, count, a, b, cols, begin, end, func); });
+        }
+
+        // Converts one element with the semantics of _Method, see Conversion. Only integral destinations
+        // are rounded or clamped, everything else is converted with _To(value).
+        template<Conversion _Method, typename _To, typename _From>
+        inline _To ConvertElement(const _From value, std::true_type /* floating point to integer */, std::false_type)
+        {
+            if (_Method == Conversion::Truncate)
+                return _To(value);
+
+            const _From rounded = std::nearbyint(value);
+            if (_Method == Conversion::Saturate)
+            {
+                if (rounded != rounded) return _To(0);
+                // the limits are powers of two or their neighbours, so the comparison against the converted limit is exact
+                if (rounded <= _From(std::numeric_limits<_To>::lowest())) return std::numeric_limits<_To>::lowest();
+                if (rounded >= _From(std::numeric_limits<_To>::max())) return std::numeric_limits<_To>::max();
+            }
+            return _To(rounded);
+        }
+
+        template<Conversion _Method, typename _To, typename _From>
+        inline _To ConvertElement(const _From value, std::false_type, std::true_type /* integer to integer */)
+        {
+            if (_Method != Conversion::Saturate)
+                return _To(value);
+
+            if (std::is_signed<_From>::value and intmax_t(value) < 0)
+                return (intmax_t(value) < intmax_t(std::numeric_limits<_To>::lowest())) ? std::numeric_limits<_To>::lowest() : _To(value);
+            return (uintmax_t(value) > uintmax_t(std::numeric_limits<_To>::max())) ? std::numeric_limits<_To>::max() : _To(value);
+        }
+
+        template<Conversion _Method, typename _To, typename _From>
+        inline _To ConvertElement(const _From value, std::false_type, std::false_type)
+        {
+            return _To(value);
+        }
+
+        template<Conversion _Method, typename _To, typename _From>
+        inline _To ConvertElement(const _From value)
+        {
+            const bool integral_to = std::is_integral<_To>::value and not std::is_same<_To, bool>::value;
+
+            return ConvertElement<_Method, _To>(value,
+                std::integral_constant<bool, integral_to and std::is_floating_point<_From>::value>(),
+                std::integral_constant<bool, integral_to and std::is_integral<_From>::value>());
+        }
+
+        // Converts [c_registers] registers of floats or doubles and stores them into an array of _Elem
+        template<typename _Elem>
+        struct SimdConvertStore
+        {
+            const static bool c_from_float = false;
+            const static bool c_from_double = false;
+        };
+
+#ifdef _MATRIX_SIMD
+        template<>
+        struct SimdConvertStore<float>
+        {
+            const static bool c_from_float = true;
+            const static bool c_from_double = true;
+            const static size_t c_registers = 1;
+            template<Conversion _Method> static void Float(float* p, const SimdFloat* v) { SimdStore<float>::Float(p, v[0]); }
+            template<Conversion _Method> static void Double(float* p, const SimdDouble* v) { SimdStore<float>::Double(p, v[0]); }
+        };
+
+        template<>
+        struct SimdConvertStore<double>
+        {
+            const static bool c_from_float = false;
+            const static bool c_from_double = true;
+            const static size_t c_registers = 1;
+            template<Conversion _Method> static void Double(double* p, const SimdDouble* v) { SimdStore<double>::Double(p, v[0]); }
+        };
+
+        // Rounds a register to int32 like ConvertElement(), Saturate clamps to [low, high] first and turns NaN into 0.
+        // Floats from 2^31 on convert to 0x80000000 and are flipped to INT32_MAX. Every double register becomes the
+        // lower half of an int register.
+#ifdef _MATRIX_SIMD_AVX2
+        template<Conversion _Method>
+        inline __m256i SimdToInt32(SimdFloat v, const float low, const float high)
+        {
+            if (_Method == Conversion::Truncate)
+                return _mm256_cvttps_epi32(v);
+            if (_Method == Conversion::Saturate)
+            {
+                v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+                v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(low)), _mm256_set1_ps(high));
+                const __m256 overflow = _mm256_cmp_ps(v, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+                return _mm256_xor_si256(_mm256_cvtps_epi32(v), _mm256_castps_si256(overflow));
+            }
+            return _mm256_cvtps_epi32(v);
+        }
+
+        template<Conversion _Method>
+        inline __m128i SimdToInt32(SimdDouble v, const double low, const double high)
+        {
+            if (_Method == Conversion::Truncate)
+                return _mm256_cvttpd_epi32(v);
+            if (_Method == Conversion::Saturate)
+            {
+                v = _mm256_and_pd(v, _mm256_cmp_pd(v, v, _CMP_ORD_Q));
+                v = _mm256_min_pd(_mm256_max_pd(v, _mm256_set1_pd(low)), _mm256_set1_pd(high));
+            }
+            return _mm256_cvtpd_epi32(v);
+        }
+#else
+        template<Conversion _Method>
+        inline __m128i SimdToInt32(SimdFloat v, const float low, const float high)
+        {
+            if (_Method == Conversion::Truncate)
+                return _mm_cvttps_epi32(v);
+            if (_Method == Conversion::Saturate)
+            {
+                v = _mm_and_ps(v, _mm_cmpord_ps(v, v));
+                v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(low)), _mm_set1_ps(high));
+                const __m128 overflow = _mm_cmpge_ps(v, _mm_set1_ps(2147483648.0f));
+                return _mm_xor_si128(_mm_cvtps_epi32(v), _mm_castps_si128(overflow));
+            }
+            return _mm_cvtps_epi32(v);
+        }
+
+        template<Conversion _Method>
+        inline __m128i SimdToInt32(SimdDouble v, const double low, const double high)
+        {
+            if (_Method == Conversion::Truncate)
+                return _mm_cvttpd_epi32(v);
+            if (_Method == Conversion::Saturate)
+            {
+                v = _mm_and_pd(v, _mm_cmpord_pd(v, v));
+                v = _mm_min_pd(_mm_max_pd(v, _mm_set1_pd(low)), _mm_set1_pd(high));
+            }
+            return _mm_cvtpd_epi32(v);
+        }
+#endif // _MATRIX_SIMD_AVX2
+
+        template<>
+        struct SimdConvertStore<int32_t>
+        {
+            const static bool c_from_float = true;
+            const static bool c_from_double = true;
+            const static size_t c_registers = 1;
+
+            template<Conversion _Method> static void Float(int32_t* p, const SimdFloat* v)
+            {
+#ifdef _MATRIX_SIMD_AVX2
+                _mm256_storeu_si256((__m256i*)p, SimdToInt32<_Method>(v[0], -2147483648.0f, 2147483648.0f));
+#else
+                _mm_storeu_si128((__m128i*)p, SimdToInt32<_Method>(v[0], -2147483648.0f, 2147483648.0f));
+#endif // _MATRIX_SIMD_AVX2
+            }
+
+            template<Conversion _Method> static void Double(int32_t* p, const SimdDouble* v)
+            {
+#ifdef _MATRIX_SIMD_AVX2
+                _mm_storeu_si128((__m128i*)p, SimdToInt32<_Method>(v[0], -2147483648.0, 2147483647.0));
+#else
+                _mm_storel_epi64((__m128i*)p, SimdToInt32<_Method>(v[0], -2147483648.0, 2147483647.0));
+#endif // _MATRIX_SIMD_AVX2
+            }
+        };
+
+        // Four registers are packed together, so every store writes a whole register of bytes or at least
+        // 8 of them. Without saturation only the lowest byte is kept, like the scalar conversion does.
+        template<>
+        struct SimdConvertStore<uint8_t>
+        {
+            const static bool c_from_float = true;
+            const static bool c_from_double = true;
+            const static size_t c_registers = 4;
+
+#ifdef _MATRIX_SIMD_AVX2
+            template<Conversion _Method> static void Float(uint8_t* p, const SimdFloat* v)
+            {
+                __m256i ints[4];
+                for (size_t i = 0; i < 4; i++)
+                {
+                    ints[i] = SimdToInt32<_Method>(v[i], 0.0f, 255.0f);
+                    if (_Method != Conversion::Saturate) ints[i] = _mm256_and_si256(ints[i], _mm256_set1_epi32(0xFF));
+                }
+
+                // both packs work within the 128 bit halves, the permutation restores the order of the elements
+                const __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(ints[0], ints[1]), _mm256_packs_epi32(ints[2], ints[3]));
+                _mm256_storeu_si256((__m256i*)p, _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+            }
+#else
+            template<Conversion _Method> static void Float(uint8_t* p, const SimdFloat* v)
+            {
+                __m128i ints[4];
+                for (size_t i = 0; i < 4; i++)
+                {
+                    ints[i] = SimdToInt32<_Method>(v[i], 0.0f, 255.0f);
+                    if (_Method != Conversion::Saturate) ints[i] = _mm_and_si128(ints[i], _mm_set1_epi32(0xFF));
+                }
+
+                _mm_storeu_si128((__m128i*)p, _mm_packus_epi16(_mm_packs_epi32(ints[0], ints[1]), _mm_packs_epi32(ints[2], ints[3])));
+            }
+#endif // _MATRIX_SIMD_AVX2
+
+            template<Conversion _Method> static void Double(uint8_t* p, const SimdDouble* v)
+            {
+                __m128i ints[4];
+                for (size_t i = 0; i < 4; i++)
+                {
+                    ints[i] = SimdToInt32<_Method>(v[i], 0.0, 255.0);
+                    if (_Method != Conversion::Saturate) ints[i] = _mm_and_si128(ints[i], _mm_set1_epi32(0xFF));
+                }
+
+#ifdef _MATRIX_SIMD_AVX2
+                _mm_storeu_si128((__m128i*)p, _mm_packus_epi16(_mm_packs_epi32(ints[0], ints[1]), _mm_packs_epi32(ints[2], ints[3])));
+#else
+                const __m128i words = _mm_packs_epi32(_mm_unpacklo_epi64(ints[0], ints[1]), _mm_unpacklo_epi64(ints[2], ints[3]));
+                _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(words, words));
+#endif // _MATRIX_SIMD_AVX2
+            }
+        };
+#endif // _MATRIX_SIMD
+
+        // Chooses the registers Convert() calculates in: 1 = floats, 2 = doubles, 0 = scalar. Integers are only
+        // converted among each other in scalar code, a detour through float would lose precision.
+        template<typename _ElemA, typename _ElemB>
+        struct ConvertPath
+        {
+#ifdef _MATRIX_SIMD
+            const static bool c_floating = std::is_floating_point<_ElemA>::value or std::is_floating_point<_ElemB>::value;
+
+            const static int c_value = (not c_floating or std::is_same<_ElemA, _ElemB>::value) ? 0 :
+                (SimdLoad<_ElemA>::c_to_float and SimdConvertStore<_ElemB>::c_from_float) ? 1 :
+                (SimdLoad<_ElemA>::c_to_double and SimdConvertStore<_ElemB>::c_from_double) ? 2 : 0;
+#else
+            const static int c_value = 0;
+#endif // _MATRIX_SIMD
+        };
+
+        // The SIMD part of ConvertRange(), returns the number of converted elements
+        template<Conversion _Method, typename _ElemA, typename _ElemB>
+        inline size_t ConvertSimd(const _ElemA*, _ElemB*, const size_t, std::integral_constant<int, 0>)
+        {
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<Conversion _Method, typename _ElemA, typename _ElemB>
+        inline size_t ConvertSimd(const _ElemA* a, _ElemB* b, const size_t count, std::integral_constant<int, 1>)
+        {
+            const size_t registers = SimdConvertStore<_ElemB>::c_registers;
+            const size_t step = registers * c_simd_floats;
+            const size_t end = count - (count % step);
+
+            for (size_t i = 0; i < end; i += step)
+            {
+                SimdFloat v[registers];
+                for (size_t r = 0; r < registers; r++)
+                    v[r] = SimdLoad<_ElemA>::Float(a + i + (r * c_simd_floats));
+                SimdConvertStore<_ElemB>::template Float<_Method>(b + i, v);
+            }
+            return end;
+        }
+
+        template<Conversion _Method, typename _ElemA, typename _ElemB>
+        inline size_t ConvertSimd(const _ElemA* a, _ElemB* b, const size_t count, std::integral_constant<int, 2>)
+        {
+            const size_t registers = SimdConvertStore<_ElemB>::c_registers;
+            const size_t step = registers * c_simd_doubles;
+            const size_t end = count - (count % step);
+
+            for (size_t i = 0; i < end; i += step)
+            {
+                SimdDouble v[registers];
+                for (size_t r = 0; r < registers; r++)
+                    v[r] = SimdLoad<_ElemA>::Double(a + i + (r * c_simd_doubles));
+                SimdConvertStore<_ElemB>::template Double<_Method>(b + i, v);
+            }
+            return end;
+        }
+#endif // _MATRIX_SIMD
+
+        template<Conversion _Method, typename _ElemA, typename _ElemB>
+        inline void ConvertRange(const _ElemA* a, _ElemB* b, const size_t count)
+        {
+            size_t i = ConvertSimd<_Method>(a, b, count, std::integral_constant<int, ConvertPath<_ElemA, _ElemB>::c_value>());
+
+            for (; i < count; i++)
+                b[i] = ConvertElement<_Method, _ElemB>(a[i]);
+        }
+
+        template<Conversion _Method, typename _ElemA, typename _ElemB>
+        inline void Convert(const _ElemA* a, _ElemB* b, const size_t count)
+        {
+            ParallelElements<_ElemB>(count, [=](const size_t begin, const size_t end) { ConvertRange<_Method>(a + begin, b + begin, end - begin); });
+        }
+
+        // Converting into the same type is a copy with every method
+        template<Conversion _Method, typename _Elem>
+        inline void Convert(const _Elem* a, _Elem* b, const size_t count)
+        {
+            if (a != b)
+                ParallelElements<_Elem>(count, [=](const size_t begin, const size_t end) { CopyRow(a + begin, b + begin, end - begin); });
+        }
+
+        template<typename _ElemA, typename _ElemB>
+        inline void Convert(const _ElemA* a, _ElemB* b, const size_t count, const Conversion method)
+        {
+            switch (method)
+            {
+            case Conversion::Truncate: Convert<Conversion::Truncate>(a, b, count); break;
+            case Conversion::Round: Convert<Conversion::Round>(a, b, count); break;
+            case Conversion::Saturate: Convert<Conversion::Saturate>(a, b, count); break;
+            }
+        }
+
+        // Whether [a] is sorted in front of [b], NaNs go last in both orders
+        template<SortOrder _Order, typename _Elem>
+        inline bool SortsBefore(const _Elem a, const _Elem b)
+        {
+            if (b != b) return a == a;
+            return (_Order == SortOrder::Ascending) ? (a < b) : (b < a);
+        }
+
+        // An element together with its column, equal elements are ordered by the column
+        template<typename _Elem>
+        struct RankedElement
+        {
+            _Elem value;
+            size_t index;
+        };
+
+        template<SortOrder _Order, typename _Elem>
+        struct RanksBefore
+        {
+            bool operator () (const RankedElement<_Elem>& a, const RankedElement<_Elem>& b) const
+            {
+                if (SortsBefore<_Order>(a.value, b.value)) return true;
+                if (SortsBefore<_Order>(b.value, a.value)) return false;
+                return a.index < b.index;
+            }
+        };
+
+        // Sorts each of the [rows] rows of [b] in place. Elements that compare equal can still differ, like 0 and -0
+        // or NaNs with different payloads, so they are sorted with their column like in ArgSortEachRow() and keep
+        // their order. std::stable_sort would allocate a buffer for every row.
+        template<SortOrder _Order, typename _Elem>
+        inline void SortEachRow(_Elem* b, const size_t rows, const size_t cols)
+        {
+            ParallelFor(rows, std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    // one buffer for all rows of the range
+                    std::vector<RankedElement<_Elem>> ranked(cols);
+
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        _Elem* values = b + (row * cols);
+                        for (size_t col = 0; col < cols; col++)
+                            ranked[col] = { values[col], col };
+
+                        std::sort(ranked.begin(), ranked.end(), RanksBefore<_Order, _Elem>());
+
+                        for (size_t col = 0; col < cols; col++)
+                            values[col] = ranked[col].value;
+                    }
+                });
+        }
+
+        template<typename _Elem>
+        inline void SortEachRow(_Elem* b, const size_t rows, const size_t cols, const SortOrder order)
+        {
+            if (order == SortOrder::Ascending) SortEachRow<SortOrder::Ascending>(b, rows, cols);
+            else SortEachRow<SortOrder::Descending>(b, rows, cols);
+        }
+
+        template<SortOrder _Order, typename _Elem, typename _Index>
+        inline void ArgSortEachRow(const _Elem* a, _Index* indices, const size_t rows, const size_t cols)
+        {
+            ParallelFor(rows, std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    // one buffer for all rows of the range
+                    std::vector<RankedElement<_Elem>> ranked(cols);
+
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        for (size_t col = 0; col < cols; col++)
+                            ranked[col] = { a[(row * cols) + col], col };
+
+                        std::sort(ranked.begin(), ranked.end(), RanksBefore<_Order, _Elem>());
+
+                        for (size_t col = 0; col < cols; col++)
+                            indices[(row * cols) + col] = _Index(ranked[col].index);
+                    }
+                });
+        }
+
+        // Returns the first column from [col] on which is in front of [threshold], or [cols]. Only whole
+        // registers are compared, the caller checks the rest.
+        template<SortOrder _Order, typename _Elem>
+        inline size_t SkipRankedBehind(const _Elem*, const size_t col, const size_t, const _Elem, std::false_type)
+        {
+            return col;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<SortOrder _Order, typename _Elem>
+        inline size_t SkipRankedBehind(const _Elem* row, size_t col, const size_t cols, const _Elem threshold, std::true_type)
+        {
+            typedef SimdLane<_Elem> _Lane;
+            const typename _Lane::_V limit = _Lane::Set(threshold);
+
+            for (; col + _Lane::c_lanes <= cols; col += _Lane::c_lanes)
+            {
+                const typename _Lane::_V v = _Lane::Load(row + col);
+                if (SimdBits((_Order == SortOrder::Ascending) ? SimdLess(v, limit) : SimdLess(limit, v)) != 0)
+                    break;
+            }
+            return col;
+        }
+#endif // _MATRIX_SIMD
+
+        // Selects the [k] best elements of a row into [ranked], which holds [k] elements, best first. Keeps a heap
+        // whose root is the worst selected element and skips whole registers which can't beat it.
+        template<SortOrder _Order, typename _Elem>
+        inline void TopKHeap(const _Elem* row, const size_t cols, RankedElement<_Elem>* ranked, const size_t k)
+        {
+            const RanksBefore<_Order, _Elem> before;
+#ifdef _MATRIX_SIMD
+            const std::integral_constant<bool, std::is_same<_Elem, float>::value or std::is_same<_Elem, double>::value> simd;
+#else
+            const std::false_type simd;
+#endif // _MATRIX_SIMD
+
+            for (size_t col = 0; col < k; col++)
+                ranked[col] = { row[col], col };
+            std::make_heap(ranked, ranked + k, before);
+
+            for (size_t col = k; col < cols; col++)
+            {
+                // a NaN in the heap is beaten by every number, so the registers can't be skipped
+                const _Elem worst = ranked[0].value;
+                if (worst == worst)
+                {
+                    col = SkipRankedBehind<_Order>(row, col, cols, worst, simd);
+                    if (col == cols) break;
+                }
+
+                // every later column ranks behind an equal element
+                if (SortsBefore<_Order>(row[col], worst))
+                {
+                    std::pop_heap(ranked, ranked + k, before);
+                    ranked[k - 1] = { row[col], col };
+                    std::push_heap(ranked, ranked + k, before);
+                }
+            }
+
+            std::sort_heap(ranked, ranked + k, before);
+        }
+
+        // The same for large [k], [ranked] holds all [cols] elements
+        template<SortOrder _Order, typename _Elem>
+        inline void TopKSelect(const _Elem* row, const size_t cols, RankedElement<_Elem>* ranked, const size_t k)
+        {
+            const RanksBefore<_Order, _Elem> before;
+
+            for (size_t col = 0; col < cols; col++)
+                ranked[col] = { row[col], col };
+
+            std::nth_element(ranked, ranked + (k - 1), ranked + cols, before);
+            std::sort(ranked, ranked + k, before);
+        }
+
+        template<SortOrder _Order, typename _ElemA, typename _ElemB, typename _Index>
+        inline void TopKEachRow(const _ElemA* a, _ElemB* b, _Index* indices, const size_t rows, const size_t cols, const size_t k)
+        {
+            // the heap only pays off while most elements are skipped, i.e. k is small compared to the row
+            const bool heap = (k * 16) <= cols;
+
+            ParallelFor(rows, std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1), [=](const size_t begin, const size_t end)
+                {
+                    // one buffer for all rows of the range
+                    std::vector<RankedElement<_ElemA>> ranked(heap ? k : cols);
+
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        if (heap) TopKHeap<_Order>(a + (row * cols), cols, ranked.data(), k);
+                        else TopKSelect<_Order>(a + (row * cols), cols, ranked.data(), k);
+
+                        for (size_t i = 0; i < k; i++)
+                        {
+                            b[(row * k) + i] = _ElemB(ranked[i].value);
+                            indices[(row * k) + i] = _Index(ranked[i].index);
+                        }
+                    }
+                });
+        }
+
+#ifdef _MATRIX_SIMD
+        // The inclusive prefix sum of the lanes of a register and a register filled with its last lane
+#ifdef _MATRIX_SIMD_AVX2
+        inline SimdFloat SimdPrefixSum(SimdFloat v)
+        {
+            v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 4)));
+            v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 8)));
+            // both halves are scanned separately, the last lane of the lower half is added to the upper one
+            const SimdFloat low = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+            return _mm256_add_ps(v, _mm256_permute2f128_ps(low, low, 0x08));
+        }
+
+        inline SimdDouble SimdPrefixSum(SimdDouble v)
+        {
+            v = _mm256_add_pd(v, _mm256_castsi256_pd(_mm256_slli_si256(_mm256_castpd_si256(v), 8)));
+            const SimdDouble low = _mm256_permute_pd(v, 0xF);
+            return _mm256_add_pd(v, _mm256_permute2f128_pd(low, low, 0x08));
+        }
+
+        struct SimdInt32Lane
+        {
+            typedef __m256i _V;
+            const static size_t c_lanes = 8;
+            static __m256i Zero(void) { return _mm256_setzero_si256(); }
+            static __m256i Add(const __m256i a, const __m256i b) { return _mm256_add_epi32(a, b); }
+            static __m256i Load(const int32_t* p) { return _mm256_loadu_si256((const __m256i*)p); }
+            static void Store(int32_t* p, const __m256i v) { _mm256_storeu_si256((__m256i*)p, v); }
+        };
+
+        inline __m256i SimdPrefixSum(__m256i v)
+        {
+            v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+            v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+            const __m256i low = _mm256_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+            return _mm256_add_epi32(v, _mm256_permute2x128_si256(low, low, 0x08));
+        }
+
+        inline SimdFloat SimdLastLane(const SimdFloat v) { return _mm256_permute_ps(_mm256_permute2f128_ps(v, v, 0x11), _MM_SHUFFLE(3, 3, 3, 3)); }
+        inline SimdDouble SimdLastLane(const SimdDouble v) { return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0xF); }
+        inline __m256i SimdLastLane(const __m256i v) { return _mm256_shuffle_epi32(_mm256_permute2x128_si256(v, v, 0x11), _MM_SHUFFLE(3, 3, 3, 3)); }
+#else
+        inline SimdFloat SimdPrefixSum(SimdFloat v)
+        {
+            v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+            return _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+        }
+
+        inline SimdDouble SimdPrefixSum(const SimdDouble v) { return _mm_add_pd(v, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(v), 8))); }
+
+        struct SimdInt32Lane
+        {
+            typedef __m128i _V;
+            const static size_t c_lanes = 4;
+            static __m128i Zero(void) { return _mm_setzero_si128(); }
+            static __m128i Add(const __m128i a, const __m128i b) { return _mm_add_epi32(a, b); }
+            static __m128i Load(const int32_t* p) { return _mm_loadu_si128((const __m128i*)p); }
+            static void Store(int32_t* p, const __m128i v) { _mm_storeu_si128((__m128i*)p, v); }
+        };
+
+        inline __m128i SimdPrefixSum(__m128i v)
+        {
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+            return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        }
+
+        inline SimdFloat SimdLastLane(const SimdFloat v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+        inline SimdDouble SimdLastLane(const SimdDouble v) { return _mm_unpackhi_pd(v, v); }
+        inline __m128i SimdLastLane(const __m128i v) { return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3)); }
+#endif // _MATRIX_SIMD_AVX2
+#endif // _MATRIX_SIMD
+
+        // Loads one register of 32 bit integers for the integer path of ScanRow()
+        template<typename _Elem>
+        struct SimdLoadInt32
+        {
+            const static bool c_value = false;
+        };
+
+#ifdef _MATRIX_SIMD
+        template<>
+        struct SimdLoadInt32<uint8_t>
+        {
+            const static bool c_value = true;
+#ifdef _MATRIX_SIMD_AVX2
+            static __m256i Load(const uint8_t* p) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p)); }
+#else
+            static __m128i Load(const uint8_t* p)
+            {
+                int32_t bytes;
+                memcpy(&bytes, p, sizeof(bytes));
+                const __m128i zero = _mm_setzero_si128();
+                return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+            }
+#endif // _MATRIX_SIMD_AVX2
+        };
+
+        template<>
+        struct SimdLoadInt32<int32_t>
+        {
+            const static bool c_value = true;
+            static SimdInt32Lane::_V Load(const int32_t* p) { return SimdInt32Lane::Load(p); }
+        };
+
+        template<>
+        struct SimdLoadInt32<uint32_t>
+        {
+            const static bool c_value = true;
+            static SimdInt32Lane::_V Load(const uint32_t* p) { return SimdInt32Lane::Load((const int32_t*)p); }
+        };
+#endif // _MATRIX_SIMD
+
+        // How ScanRow() calculates: 1 = float or double sums in SIMD registers, 2 = 32 bit integer sums, which wrap
+        // around the same way for signed and unsigned, 0 = scalar
+        template<typename _ElemA, typename _ElemB>
+        struct ScanPath
+        {
+#ifdef _MATRIX_SIMD
+            const static int c_value =
+                ((std::is_same<_ElemB, float>::value and SimdLoad<_ElemA>::c_to_float) or
+                    (std::is_same<_ElemB, double>::value and SimdLoad<_ElemA>::c_to_double)) ? 1 :
+                ((std::is_same<_ElemB, int32_t>::value or std::is_same<_ElemB, uint32_t>::value) and SimdLoadInt32<_ElemA>::c_value) ? 2 : 0;
+#else
+            const static int c_value = 0;
+#endif // _MATRIX_SIMD
+        };
+
+        // The SIMD part of ScanRow(), returns the number of processed elements and leaves their sum in [sum]
+        template<typename _ElemA, typename _ElemB>
+        inline size_t ScanRowSimd(const _ElemA*, const _ElemB*, _ElemB*, const size_t, _ElemB&, std::integral_constant<int, 0>)
+        {
+            return 0;
+        }
+
+#ifdef _MATRIX_SIMD
+        template<typename _ElemA, typename _ElemB>
+        inline size_t ScanRowSimd(const _ElemA* a, const _ElemB* prev, _ElemB* b, const size_t cols, _ElemB& sum, std::integral_constant<int, 1>)
+        {
+            typedef SimdLane<_ElemB> _Lane;
+            const size_t end = cols - (cols % _Lane::c_lanes);
+
+            // the running sum only waits for one addition per register, the scan within it is independent
+            typename _Lane::_V carry = _Lane::Set(0.0);
+            for (size_t col = 0; col < end; col += _Lane::c_lanes)
+            {
+                const typename _Lane::_V row = SimdAdd(SimdPrefixSum(_Lane::template Load<_ElemA>(a + col)), carry);
+                carry = SimdLastLane(row);
+                _Lane::Store(b + col, prev ? SimdAdd(_Lane::Load(prev + col), row) : row);
+            }
+
+            _ElemB last[_Lane::c_lanes];
+            _Lane::Store(last, carry);
+            sum = last[0];
+            return end;
+        }
+
+        template<typename _ElemA, typename _ElemB>
+        inline size_t ScanRowSimd(const _ElemA* a, const _ElemB* prev, _ElemB* b, const size_t cols, _ElemB& sum, std::integral_constant<int, 2>)
+        {
+            typedef SimdInt32Lane _Lane;
+            const size_t end = cols - (cols % _Lane::c_lanes);
+
+            typename _Lane::_V carry = _Lane::Zero();
+            for (size_t col = 0; col < end; col += _Lane::c_lanes)
+            {
+                const typename _Lane::_V row = _Lane::Add(SimdPrefixSum(SimdLoadInt32<_ElemA>::Load(a + col)), carry);
+                carry = SimdLastLane(row);
+                _Lane::Store((int32_t*)(b + col), prev ? _Lane::Add(_Lane::Load((const int32_t*)(prev + col)), row) : row);
+            }
+
+            int32_t last[_Lane::c_lanes];
+            _Lane::Store(last, carry);
+            sum = _ElemB(last[0]);
+            return end;
+        }
+#endif // _MATRIX_SIMD
+
+        // b[j] = prev[j] + a[0] + ... + a[j], summed up in _ElemB. [prev] may be nullptr.
+        template<typename _ElemA, typename _ElemB>
+        inline void ScanRow(const _ElemA* a, const _ElemB* prev, _ElemB* b, const size_t cols)
+        {
+            _ElemB sum = _ElemB(0);
+            size_t col = ScanRowSimd(a, prev, b, cols, sum, std::integral_constant<int, ScanPath<_ElemA, _ElemB>::c_value>());
+
+            if (prev)
+            {
+                for (; col < cols; col++)
+                {
+                    sum += _ElemB(a[col]);
+                    b[col] = _ElemB(prev[col] + sum);
+                }
+            }
+            else
+            {
+                for (; col < cols; col++)
+                {
+                    sum += _ElemB(a[col]);
+                    b[col] = sum;
+                }
+            }
+        }
+
+        // Calls row_op(a_row, prev_row, b_row) from the top to the bottom, prev_row being the result of the row above,
+        // and adds up the rows like CumSumCols() does. Every thread starts its range of rows with a nullptr as prev_row,
+        // afterwards the last rows are carried serially from range to range and each range adds the last row of the
+        // range above it to its other rows.
+        template<typename _ElemA, typename _ElemB, typename _RowOp>
+        inline void ScanDown(const _ElemA* a, _ElemB* b, const size_t rows, const size_t cols, _RowOp&& row_op)
+        {
+            const size_t grain = std::max<size_t>(ParallelThreshold() / std::max<size_t>(cols, 1), 1);
+
+            std::vector<uint8_t> range_end(rows, 0);
+
+            ParallelFor(rows, grain, [&](const size_t begin, const size_t end)
+                {
+                    for (size_t row = begin; row < end; row++)
+                        row_op(a + (row * cols), (row == begin) ? nullptr : b + ((row - 1) * cols), b + (row * cols));
+                    range_end[end - 1] = 1;
+                });
+
+            size_t previous = 0, ranges = 0;
+            for (size_t row = 0; row < rows; row++)
+                if (range_end[row])
+                {
+                    if (ranges++ > 0)
+                        ElementwiseRange<OpAdd>(b + (row * cols), b + (previous * cols), b + (row * cols), cols, false);
+                    previous = row;
+                }
+
+            if (ranges < 2)
+                return;
+
+            // ParallelFor() splits the rows the same way again
+            ParallelFor(rows, grain, [=](const size_t begin, const size_t end)
+                {
+                    if (begin == 0)
+                        return;
+
+                    for (size_t row = begin; row + 1 < end; row++)
+                        ElementwiseRange<OpAdd>(b + (row * cols), b + ((begin - 1) * cols), b + (row * cols), cols, false);
+                });
+        }
+
+        // true if the [countA] elements from [a] share memory with the [countB] elements from [b]
+        template<typename _ElemA, typename _ElemB>
+        inline bool Overlaps(const _ElemA* a, const size_t countA, const _ElemB* b, const size_t countB)
+        {
+            return uintptr_t(a) < uintptr_t(b + countB) and uintptr_t(b) < uintptr_t(a + countA);
+        }
+    }
+}
+
+
+//
+///
+//// Function Definitions:
+///
+//
+
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemB>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const _ElemB init) :
+    p_mat(new _Elem[_Rows * _Cols])
+{
+    // the threads which initialize the pages are the ones which process them later
+    Internal::Fill(p_mat, c_elements, _Elem(init));
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const Matrix2D& _initilizer) :
+    p_mat(new _Elem[_Rows * _Cols])
+{
+    memcpy(p_mat, _initilizer.p_mat, _Cols * _Rows * sizeof(_Elem));
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(Matrix2D&& _initilizer) :
+    p_mat(_initilizer.p_mat)
+{
+    _initilizer.p_mat = nullptr;
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemB>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(Matrix2D<_ElemB, _Rows, _Cols>& _initilizer, const Conversion method) :
+    p_mat(new _Elem[_Rows * _Cols])
+{
+    Internal::Convert(&_initilizer[0], p_mat, c_elements, method);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(const std::initializer_list<std::initializer_list<_Elem>> lists) :
+    p_mat(new _Elem[_Rows * _Cols])
+{
+    size_t i = 0;
+    for (const auto list : lists)
+        for (const auto element : list)
+        {
+            if (i < c_elements) p_mat[i++] = element;
+            else i++;
+        }
+
+    if (i != c_elements) std::cout << "ERROR! Initializing matrix with " << i << " elements, " << c_elements << " expected!" << std::endl;
+    if (i < c_elements) memset(p_mat + i, 0, (c_elements - i) * sizeof(_Elem));
+}
+
+#undef _MATRIX_P_MAT_ASSIGNMENT
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::Matrix2D(_Elem* ptr) :
+    p_mat(ptr)
+{}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>::~Matrix2D(void)
+{
+    delete[] p_mat;
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _Cast>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::cout(void)
+{
+    // calculate the longest element per [_Cols] (column)
+    // generate a string with all elements, separated by a space [' ']
+    std::stringstream ss;
+    for (size_t i = 0; i < (_Cols * _Rows); i++)
+        ss << _Cast(p_mat[i]) << ' ';
+    std::istream_iterator<std::string> begin(ss);
+    std::istream_iterator<std::string> end;
+    std::vector <std::string> mat_vals(begin, end);
+
+    // find out the longest string per [_Cols] 
+    size_t max_length[_Cols] = { 0 };
+    for (size_t row = 0; row < _Rows; row++)
+        for (size_t column = 0; column < _Cols; column++)
+            max_length[column] = std::max(max_length[column], mat_vals[POS_XY(row, column)].size());
+
+
+    // increase all by one to add 1 space of padding
+    for (auto& element : max_length)
+        element += 1;
+
+    // print each element with the needed padding corresponding to the longest
+    // element in the same [_Cols]
+    for (size_t i = 0; i < (_Cols * _Rows); i++)
+    {
+        if ((i % _Cols) == 0) std::cout << '|';
+        std::cout << std::setw(max_length[i % _Cols]) << _Cast(p_mat[i]);
+        if ((i % _Cols) == _Cols - 1) std::cout << ' ' << '|' << std::endl;
         else std::cout << ',';
     }
 }
@@ -388,7 +5328,31 @@ void Matrix::Matrix2D<_Elem, _Rows, _Cols>::cout(void)
 template<typename _Elem, size_t _Rows, size_t _Cols>
 void Matrix::Matrix2D<_Elem, _Rows, _Cols>::clear(void)
 {
-    memset(p_mat, 0, _Rows * _Cols * sizeof(_Elem));
+    Internal::Zero(p_mat, _Rows * _Cols);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+_Elem* Matrix::Matrix2D<_Elem, _Rows, _Cols>::release(void)
+{
+    _Elem* ptr = p_mat;
+    p_mat = nullptr;
+    return ptr;
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<size_t _NewRows, size_t _NewCols>
+Matrix::MatrixView<_Elem, _NewRows, _NewCols> Matrix::Matrix2D<_Elem, _Rows, _Cols>::Reshape(void) &
+{
+    static_assert(_NewRows * _NewCols == _Rows * _Cols, "MATRIX ASSERT: Reshape() must keep the number of elements!");
+    return MatrixView<_Elem, _NewRows, _NewCols>(p_mat, ptrdiff_t(_NewCols), 1);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<size_t _NewRows, size_t _NewCols>
+Matrix::Matrix2D<_Elem, _NewRows, _NewCols> Matrix::Matrix2D<_Elem, _Rows, _Cols>::Reshape(void) &&
+{
+    static_assert(_NewRows * _NewCols == _Rows * _Cols, "MATRIX ASSERT: Reshape() must keep the number of elements!");
+    return Matrix2D<_Elem, _NewRows, _NewCols>(release());
 }
 
 template<typename _Elem, size_t _Rows, size_t _Cols>
@@ -425,6 +5389,13 @@ Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::op
     return *this;
 }
 
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::operator = (Matrix2D&& _mat2)
+{
+    std::swap(p_mat, _mat2.p_mat);
+    return *this;
+}
+
 template<typename _Elem, size_t _Rows, size_t _Cols>
 Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::operator = (_Elem* ptr)
 {
@@ -436,8 +5407,19 @@ Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::op
 template<typename _Elem, size_t _Rows, size_t _Cols>
 Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::operator = (const _Elem val)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        p_mat[i] = val;
+    if (p_mat == NULL) p_mat = new _Elem[_Cols * _Rows];
+
+    Internal::Fill(p_mat, _Rows * _Cols, val);
+    return *this;
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemB>
+Matrix::Matrix2D<_Elem, _Rows, _Cols>& Matrix::Matrix2D<_Elem, _Rows, _Cols>::operator = (Matrix2D<_ElemB, _Rows, _Cols>& _mat2)
+{
+    if (p_mat == NULL) p_mat = new _Elem[_Cols * _Rows];
+
+    Internal::Convert(&_mat2[0], p_mat, c_elements, Conversion::Truncate);
     return *this;
 }
 
@@ -523,221 +5505,473 @@ void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>
     Matrix::Mul<_ElemA, _RowsA, _ColsA, _ElemB, _ColsB, _ElemC>(A, B, C);
 }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _Elem(A[i] + B[i]);
-}
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
+{
+    Matrix::Add(A, B, C);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::Add(A, scalar, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
+{
+    Matrix::Sub(A, B, C);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::Sub(A, scalar, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::Sub(scalar, A, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
+{
+    Matrix::MulEBE(A, B, C);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::MulEBE(A, scalar, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
+{
+    Matrix::DivEBE(A, B, C);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::DivEBE(A, scalar, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
+{
+    Matrix::DivEBE(scalar, A, B);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C, const Accuracy accuracy)
+{
+    Matrix::PowEBE(A, B, C, accuracy);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy)
+{
+    Matrix::PowEBE(A, scalar, B, accuracy);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA, typename _ElemB>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy)
+{
+    Matrix::PowEBE(scalar, A, B, accuracy);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy)
+{
+    Matrix::ExpEBE(A, B, accuracy);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+template<typename _ElemA>
+void Matrix::Matrix2D<_Elem, _Rows, _Cols>::SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const Accuracy accuracy)
+{
+    Matrix::SqrtEBE(A, B, accuracy);
+}
+
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    constexpr auto _RowsB = _ColsA;
+    constexpr auto _RowsC = _RowsA;
+    constexpr auto _ColsC = _ColsB;
+
+    // test if an input-Matrix is the same as the output-Matrix, because this would be bad
+    if (_RowsA == _RowsC and _ColsA == _ColsC)
+    {
+        if ((void*)(&A) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+            "and input A is the same object as output C. If and input is the same as "
+            "an output, the multiplication may fail and give an invalid result!" << std::endl;
+
+        if ((void*)(&B) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+            "and input B is the same object as output C. If and input is the same as "
+            "an output, the multiplication may fail and give an invalid result!" << std::endl;
+    }
+
+    /*
+    A quick reminder on how to multiply matrices
+
+    1. A.Cols == B.Rows (must equal)
+    2. The final matrix will have the dimensions A.Rows x B.Cols
+
+    Matrix A: (2 x 3)
+    -         -
+    | a, b, c |
+    | d, e, f |
+    -         -
+
+    Matrix B: (3 x 3)
+    -         -
+    | g, h, i |
+    | j, k, l |
+    | m, n, o |
+    -         -
+
+    Matrix C: ( 2 * 3)
+    -                                    -
+    | (ag+bi+ck), (ah+bk+cn), (ai+bl+co) |
+    | (dg+ei+fk), (dh+ek+fn), (di+el+fo) |
+    -                                    -
+
+    */
+
+    // Full amount of functions for Release mode
+#if defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 4)
+#pragma message  ( "Compiling Matrix2D unrolled multiplication function for up to 5x5" )
+    // using multiple if-statements to detect common Matrix sizes. The compiler will optimize all
+    // necessary if-statements for each matrix type away, since the arguments are known at compile time.
+
+    // 1x1 * 1xn
+    if (true)
+    {
+        // 1x1 * 1x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+
+            return;
+        }
+
+        // 1x1 * 1x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+
+            return;
+        }
+
+        // 1x1 * 1x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+
+            return;
+        }
+
+        // 1x1 * 1x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+
+            return;
+        }
+
+        // 1x1 * 1x5 -> 1x5
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
+
+            return;
+        }
+
+    }
+
+    // 2x1 * 1xn
+    if (true)
+    {
+        // 2x1 * 1x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+
+            return;
+        }
+
+        // 2x1 * 1x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+
+            return;
+        }
+
+        // 2x1 * 1x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+
+            return;
+        }
+
+        // 2x1 * 1x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+
+            return;
+        }
+
+        // 2x1 * 1x5 -> 2x5
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(A[i] + scalar);
-}
+            return;
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _Elem(A[i] - B[i]);
-}
+    }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(A[i] - scalar);
-}
+    // 3x1 * 1xn
+    if (true)
+    {
+        // 3x1 * 1x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::Sub(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(scalar - A[i]);
-}
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _Elem(A[i] * B[i]);
-}
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(A[i] * scalar);
-}
+            return;
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _Elem(A[i] / B[i]);
-}
+        // 3x1 * 1x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(A[i] / scalar);
-}
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::DivEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(scalar / A[i]);
-}
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_Elem, _Rows, _Cols>& C)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _Elem(std::pow(A[i], B[i]));
-}
+            return;
+        }
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemB scalar, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(std::pow(A[i], scalar));
-}
+        // 3x1 * 1x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA, typename _ElemB>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(std::pow(scalar, A[i]));
-}
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(std::exp(A[i]));
-}
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
 
-template<typename _Elem, size_t _Rows, size_t _Cols>
-template<typename _ElemA>
-void Matrix::Matrix2D<_Elem, _Rows, _Cols>::SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B)
-{
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _Elem(std::sqrt(A[i]));
-}
-
-template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
-void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
-{
-    constexpr auto _RowsB = _ColsA;
-    constexpr auto _RowsC = _RowsA;
-    constexpr auto _ColsC = _ColsB;
+            return;
+        }
 
-    // test if an input-Matrix is the same as the output-Matrix, because this would be bad
-    if (_RowsA == _RowsC and _ColsA == _ColsC)
-    {
-        if ((void*)(&A) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
-            "and input A is the same object as output C. If and input is the same as "
-            "an output, the multiplication may fail and give an invalid result!" << std::endl;
+        // 3x1 * 1x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
 
-        if ((void*)(&B) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
-            "and input B is the same object as output C. If and input is the same as "
-            "an output, the multiplication may fail and give an invalid result!" << std::endl;
-    }
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
 
-    /*
-    A quick reminder on how to multiply matrices
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
 
-    1. A.Cols == B.Rows (must equal)
-    2. The final matrix will have the dimensions A.Rows x B.Cols
+            return;
+        }
 
-    Matrix A: (2 x 3)
-    -         -
-    | a, b, c |
-    | d, e, f |
-    -         -
+        // 3x1 * 1x5 -> 3x5
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
 
-    Matrix B: (3 x 3)
-    -         -
-    | g, h, i |
-    | j, k, l |
-    | m, n, o |
-    -         -
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
 
-    Matrix C: ( 2 * 3)
-    -                                    -
-    | (ag+bi+ck), (ah+bk+cn), (ai+bl+co) |
-    | (dg+ei+fk), (dh+ek+fn), (di+el+fo) |
-    -                                    -
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
 
-    */
+            return;
+        }
 
-    // Full amount of functions for Release mode
-#if defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 4)
-#pragma message  ( "Compiling Matrix2D unrolled multiplication function for up to 5x5" )
-    // using multiple if-statements to detect common Matrix sizes. The compiler will optimize all
-    // necessary if-statements for each matrix type away, since the arguments are known at compile time.
+    }
 
-    // 1x1 * 1xn
+    // 4x1 * 1xn
     if (true)
     {
-        // 1x1 * 1x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 4x1 * 1x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+
             return;
         }
 
-        // 1x1 * 1x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 4x1 * 1x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+
             return;
         }
 
-        // 1x1 * 1x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 4x1 * 1x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
             C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+
             return;
         }
 
-        // 1x1 * 1x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 4x1 * 1x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
             C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
             C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
 
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+
             return;
         }
 
-        // 1x1 * 1x5 -> 1x5
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        // 4x1 * 1x5 -> 4x5
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
@@ -745,26 +5979,50 @@ void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _
             C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
             C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
 
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)));
+
             return;
         }
 
     }
 
-    // 2x1 * 1xn
+    // 5x1 * 1xn
     if (true)
     {
-        // 2x1 * 1x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 5x1 * 1x1 -> 5x1
+        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
             C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
 
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+
             return;
         }
 
-        // 2x1 * 1x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 5x1 * 1x2 -> 5x2
+        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
@@ -772,11 +6030,20 @@ void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _
             C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
             C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
 
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
+
             return;
         }
 
-        // 2x1 * 1x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 5x1 * 1x3 -> 5x3
+        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
@@ -786,11 +6053,23 @@ void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _
             C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
             C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
+
             return;
         }
 
-        // 2x1 * 1x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 5x1 * 1x4 -> 5x4
+        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
@@ -802,11 +6081,26 @@ void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _
             C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
             C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
 
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)));
+
             return;
         }
 
-        // 2x1 * 1x5 -> 2x5
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        // 5x1 * 1x5 -> 5x5
+        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
         {
             C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
             C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
@@ -820,3922 +6114,4650 @@ void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _
             C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
             C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
 
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)));
+            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)));
+
             return;
         }
 
     }
 
-    // 3x1 * 1xn
+    // Matrices n1x1 * 1xn2
+    if (_ColsA == 1 and _RowsB == 1)
+    {
+        for (size_t rows = 0; rows < _RowsC; rows++)
+            for (size_t cols = 0; cols < _ColsC; cols++)
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
+        return;
+    }
+
+    // 1x2 * 2xn
     if (true)
     {
-        // 3x1 * 1x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 1x2 * 2x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            return;
+        }
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+        // 1x2 * 2x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 3x1 * 1x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 1x2 * 2x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+
+            return;
+        }
+
+        // 1x2 * 2x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+
+            return;
+        }
+
+        // 1x2 * 2x5 -> 1x5
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+
+            return;
+        }
+
+    }
+
+    // 2x2 * 2xn
+    if (true)
+    {
+        // 2x2 * 2x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+
+            return;
+        }
+
+        // 2x2 * 2x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+
+            return;
+        }
+
+        // 2x2 * 2x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+
+            return;
+        }
+
+        // 2x2 * 2x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+
+            return;
+        }
+
+        // 2x2 * 2x5 -> 2x5
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
+
+            return;
+        }
+
+    }
+
+    // 3x2 * 2xn
+    if (true)
+    {
+        // 3x2 * 2x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+
+            return;
+        }
+
+        // 3x2 * 2x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 3x1 * 1x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 3x2 * 2x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
             return;
         }
 
-        // 3x1 * 1x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 3x2 * 2x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
 
             return;
         }
 
-        // 3x1 * 1x5 -> 3x5
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        // 3x2 * 2x5 -> 3x5
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
 
             return;
         }
 
     }
 
-    // 4x1 * 1xn
+    // 4x2 * 2xn
     if (true)
     {
-        // 4x1 * 1x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 4x2 * 2x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 4x1 * 1x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 4x2 * 2x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 4x1 * 1x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 4x2 * 2x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
 
             return;
         }
 
-        // 4x1 * 1x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 4x2 * 2x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
 
             return;
         }
 
-        // 4x1 * 1x5 -> 4x5
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        // 4x2 * 2x5 -> 4x5
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)));
 
             return;
         }
 
     }
 
-    // 5x1 * 1xn
+    // 5x2 * 2xn
     if (true)
     {
-        // 5x1 * 1x1 -> 5x1
-        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 5x2 * 2x1 -> 5x1
+        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 5x1 * 1x2 -> 5x2
-        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 5x2 * 2x2 -> 5x2
+        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 5x1 * 1x3 -> 5x3
-        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 5x2 * 2x3 -> 5x3
+        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
 
             return;
         }
 
-        // 5x1 * 1x4 -> 5x4
-        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 5x2 * 2x4 -> 5x4
+        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)));
 
             return;
         }
 
-        // 5x1 * 1x5 -> 5x5
-        if (_RowsA == 5 and _ColsA == 1 and _RowsB == 1 and _ColsB == 5)
+        // 5x2 * 2x5 -> 5x5
+        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)));
-            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)));
+            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)));
 
             return;
         }
 
     }
 
-    // Matrices n1x1 * 1xn2
-    if (_ColsA == 1 and _RowsB == 1)
+    // Matrices n1x2 * 2xn2
+    if (_ColsA == 2 and _RowsB == 2)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
         return;
     }
 
-    // 1x2 * 2xn
+    // 1x3 * 3xn
     if (true)
     {
-        // 1x2 * 2x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 1x3 * 3x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 1x2 * 2x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 1x3 * 3x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 1x2 * 2x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 1x3 * 3x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 1x2 * 2x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 1x3 * 3x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
             return;
         }
 
-        // 1x2 * 2x5 -> 1x5
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        // 1x3 * 3x5 -> 1x5
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
 
             return;
         }
 
     }
 
-    // 2x2 * 2xn
+    // 2x3 * 3xn
     if (true)
     {
-        // 2x2 * 2x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 2x3 * 3x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 2x2 * 2x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 2x3 * 3x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 2x2 * 2x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 2x3 * 3x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
             return;
         }
-
-        // 2x2 * 2x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+
+        // 2x3 * 3x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
             return;
         }
 
-        // 2x2 * 2x5 -> 2x5
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        // 2x3 * 3x5 -> 2x5
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
 
             return;
         }
 
     }
 
-    // 3x2 * 2xn
+    // 3x3 * 3xn
     if (true)
     {
-        // 3x2 * 2x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 3x3 * 3x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 3x2 * 2x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 3x3 * 3x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 3x2 * 2x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 3x3 * 3x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 3x2 * 2x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 3x3 * 3x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
 
             return;
         }
 
-        // 3x2 * 2x5 -> 3x5
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        // 3x3 * 3x5 -> 3x5
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
 
             return;
         }
 
     }
 
-    // 4x2 * 2xn
+    // 4x3 * 3xn
     if (true)
     {
-        // 4x2 * 2x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 4x3 * 3x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 4x2 * 2x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 4x3 * 3x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 4x2 * 2x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 4x3 * 3x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 4x2 * 2x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 4x3 * 3x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
 
             return;
         }
 
-        // 4x2 * 2x5 -> 4x5
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        // 4x3 * 3x5 -> 4x5
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)));
 
             return;
         }
 
     }
 
-    // 5x2 * 2xn
+    // 5x3 * 3xn
     if (true)
     {
-        // 5x2 * 2x1 -> 5x1
-        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 5x3 * 3x1 -> 5x1
+        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 5x2 * 2x2 -> 5x2
-        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 5x3 * 3x2 -> 5x2
+        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 5x2 * 2x3 -> 5x3
-        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 5x3 * 3x3 -> 5x3
+        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 5x2 * 2x4 -> 5x4
-        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 5x3 * 3x4 -> 5x4
+        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)));
 
             return;
         }
 
-        // 5x2 * 2x5 -> 5x5
-        if (_RowsA == 5 and _ColsA == 2 and _RowsB == 2 and _ColsB == 5)
+        // 5x3 * 3x5 -> 5x5
+        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)));
-            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)));
+            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)));
 
             return;
         }
 
     }
 
-    // Matrices n1x2 * 2xn2
-    if (_ColsA == 2 and _RowsB == 2)
+    // Matrices n1x3 * 3xn2
+    if (_ColsA == 3 and _RowsB == 3)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
         return;
     }
 
-    // 1x3 * 3xn
+    // 1x4 * 4xn
     if (true)
     {
-        // 1x3 * 3x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 1x4 * 4x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 1x3 * 3x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 1x4 * 4x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 1x3 * 3x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 1x4 * 4x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 1x3 * 3x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 1x4 * 4x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
             return;
         }
 
-        // 1x3 * 3x5 -> 1x5
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
+        // 1x4 * 4x5 -> 1x5
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
 
             return;
         }
 
     }
 
-    // 2x3 * 3xn
+    // 2x4 * 4xn
     if (true)
     {
-        // 2x3 * 3x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 2x4 * 4x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 2x3 * 3x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 2x4 * 4x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 2x3 * 3x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 2x4 * 4x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 2x3 * 3x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 2x4 * 4x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
             return;
         }
 
-        // 2x3 * 3x5 -> 2x5
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
+        // 2x4 * 4x5 -> 2x5
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
 
             return;
         }
 
     }
 
-    // 3x3 * 3xn
+    // 3x4 * 4xn
     if (true)
     {
-        // 3x3 * 3x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 3x4 * 4x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 3x3 * 3x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 3x4 * 4x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 3x3 * 3x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 3x4 * 4x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 3x3 * 3x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 3x4 * 4x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
             return;
         }
 
-        // 3x3 * 3x5 -> 3x5
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
+        // 3x4 * 4x5 -> 3x5
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
 
             return;
         }
 
     }
 
-    // 4x3 * 3xn
+    // 4x4 * 4xn
     if (true)
     {
-        // 4x3 * 3x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 4x4 * 4x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 4x3 * 3x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 4x4 * 4x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 4x3 * 3x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 4x4 * 4x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 4x3 * 3x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 4x4 * 4x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
 
             return;
         }
 
-        // 4x3 * 3x5 -> 4x5
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
+        // 4x4 * 4x5 -> 4x5
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)));
 
             return;
         }
 
     }
 
-    // 5x3 * 3xn
+    // 5x4 * 4xn
     if (true)
     {
-        // 5x3 * 3x1 -> 5x1
-        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 5x4 * 4x1 -> 5x1
+        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 5x3 * 3x2 -> 5x2
-        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 5x4 * 4x2 -> 5x2
+        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 5x3 * 3x3 -> 5x3
-        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 5x4 * 4x3 -> 5x3
+        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 5x3 * 3x4 -> 5x4
-        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 5x4 * 4x4 -> 5x4
+        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)));
 
             return;
         }
 
-        // 5x3 * 3x5 -> 5x5
-        if (_RowsA == 5 and _ColsA == 3 and _RowsB == 3 and _ColsB == 5)
+        // 5x4 * 4x5 -> 5x5
+        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)));
-            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)));
+            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)) + (A.at(4, 3) * B.at(3, 4)));
 
             return;
         }
 
     }
 
-    // Matrices n1x3 * 3xn2
-    if (_ColsA == 3 and _RowsB == 3)
+    // Matrices n1x4 * 4xn2
+    if (_ColsA == 4 and _RowsB == 4)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)));
         return;
     }
 
-    // 1x4 * 4xn
+    // 1x5 * 5xn
     if (true)
     {
-        // 1x4 * 4x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 1x5 * 5x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
 
             return;
         }
 
-        // 1x4 * 4x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 1x5 * 5x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
 
             return;
         }
 
-        // 1x4 * 4x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 1x5 * 5x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
 
             return;
         }
 
-        // 1x4 * 4x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 1x5 * 5x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
 
             return;
         }
 
-        // 1x4 * 4x5 -> 1x5
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
+        // 1x5 * 5x5 -> 1x5
+        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
 
             return;
         }
 
     }
 
-    // 2x4 * 4xn
+    // 2x5 * 5xn
     if (true)
     {
-        // 2x4 * 4x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 2x5 * 5x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
 
             return;
         }
 
-        // 2x4 * 4x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 2x5 * 5x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
 
             return;
         }
 
-        // 2x4 * 4x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 2x5 * 5x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
 
             return;
         }
 
-        // 2x4 * 4x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 2x5 * 5x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
 
             return;
         }
 
-        // 2x4 * 4x5 -> 2x5
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
+        // 2x5 * 5x5 -> 2x5
+        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
 
             return;
         }
 
     }
 
-    // 3x4 * 4xn
+    // 3x5 * 5xn
     if (true)
     {
-        // 3x4 * 4x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 3x5 * 5x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
 
             return;
         }
 
-        // 3x4 * 4x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 3x5 * 5x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
 
             return;
         }
 
-        // 3x4 * 4x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 3x5 * 5x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
 
             return;
         }
 
-        // 3x4 * 4x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 3x5 * 5x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
 
             return;
         }
 
-        // 3x4 * 4x5 -> 3x5
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
+        // 3x5 * 5x5 -> 3x5
+        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
 
             return;
         }
 
     }
 
-    // 4x4 * 4xn
+    // 4x5 * 5xn
     if (true)
     {
-        // 4x4 * 4x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 4x5 * 5x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
 
             return;
         }
 
-        // 4x4 * 4x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 4x5 * 5x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
 
             return;
         }
 
-        // 4x4 * 4x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 4x5 * 5x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
 
             return;
         }
 
-        // 4x4 * 4x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 4x5 * 5x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
 
             return;
         }
 
-        // 4x4 * 4x5 -> 4x5
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
+        // 4x5 * 5x5 -> 4x5
+        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)) + (A.at(3, 4) * B.at(4, 4)));
 
             return;
         }
 
     }
 
-    // 5x4 * 4xn
+    // 5x5 * 5xn
     if (true)
     {
-        // 5x4 * 4x1 -> 5x1
-        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 5x5 * 5x1 -> 5x1
+        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
 
             return;
         }
 
-        // 5x4 * 4x2 -> 5x2
-        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 5x5 * 5x2 -> 5x2
+        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
 
             return;
         }
 
-        // 5x4 * 4x3 -> 5x3
-        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 5x5 * 5x3 -> 5x3
+        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
 
             return;
         }
 
-        // 5x4 * 4x4 -> 5x4
-        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 5x5 * 5x4 -> 5x4
+        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
+
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)) + (A.at(4, 4) * B.at(4, 3)));
 
             return;
         }
 
-        // 5x4 * 4x5 -> 5x5
-        if (_RowsA == 5 and _ColsA == 4 and _RowsB == 4 and _ColsB == 5)
+        // 5x5 * 5x5 -> 5x5
+        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
+            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)) + (A.at(3, 4) * B.at(4, 4)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)));
-            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)) + (A.at(4, 3) * B.at(3, 4)));
+            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
+            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
+            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
+            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)) + (A.at(4, 4) * B.at(4, 3)));
+            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)) + (A.at(4, 3) * B.at(3, 4)) + (A.at(4, 4) * B.at(4, 4)));
 
             return;
         }
 
     }
 
-    // Matrices n1x4 * 4xn2
-    if (_ColsA == 4 and _RowsB == 4)
+    // Matrices n1x5 * 5xn2
+    if (_ColsA == 5 and _RowsB == 5)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)) + (A.at(rows, 4) * B.at(4, cols)));
         return;
     }
-
-    // 1x5 * 5xn
+#elif defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 3)
+#pragma message ("Compiling Matrix2D unrolled multiplication function for up to 4x4")
     if (true)
     {
-        // 1x5 * 5x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
+        // 1x1 * 1x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
             return;
         }
 
-        // 1x5 * 5x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
+        // 1x1 * 1x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 1x5 * 5x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
+        // 1x1 * 1x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
             return;
         }
 
-        // 1x5 * 5x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
+        // 1x1 * 1x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
 
             return;
         }
 
-        // 1x5 * 5x5 -> 1x5
-        if (_RowsA == 1 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
+    }
+
+    // 2x1 * 1xn
+    if (true)
+    {
+        // 2x1 * 1x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
 
             return;
         }
 
-    }
+        // 2x1 * 1x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-    // 2x5 * 5xn
-    if (true)
-    {
-        // 2x5 * 5x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+
+            return;
+        }
+
+        // 2x1 * 1x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
             return;
         }
 
-        // 2x5 * 5x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
+        // 2x1 * 1x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
 
             return;
         }
 
-        // 2x5 * 5x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
+    }
+
+    // 3x1 * 1xn
+    if (true)
+    {
+        // 3x1 * 1x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
 
             return;
         }
 
-        // 2x5 * 5x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
+        // 3x1 * 1x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 2x5 * 5x5 -> 2x5
-        if (_RowsA == 2 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
+        // 3x1 * 1x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+
+            return;
+        }
+
+        // 3x1 * 1x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
 
             return;
         }
 
     }
 
-    // 3x5 * 5xn
+    // 4x1 * 1xn
     if (true)
     {
-        // 3x5 * 5x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
+        // 4x1 * 1x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-
-            return;
-        }
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
-        // 3x5 * 5x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
 
             return;
         }
 
-        // 3x5 * 5x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
+        // 4x1 * 1x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 3x5 * 5x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
+        // 4x1 * 1x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
 
             return;
         }
 
-        // 3x5 * 5x5 -> 3x5
-        if (_RowsA == 3 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
+        // 4x1 * 1x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
 
             return;
         }
 
     }
 
-    // 4x5 * 5xn
+    // Matrices n1x1 * 1xn2
+    if (_ColsA == 1 and _RowsB == 1)
+    {
+        for (size_t rows = 0; rows < _RowsC; rows++)
+            for (size_t cols = 0; cols < _ColsC; cols++)
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
+        return;
+    }
+
+    // 1x2 * 2xn
     if (true)
     {
-        // 4x5 * 5x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
+        // 1x2 * 2x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 4x5 * 5x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
+        // 1x2 * 2x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            return;
+        }
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+        // 1x2 * 2x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
             return;
         }
 
-        // 4x5 * 5x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
+        // 1x2 * 2x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+            return;
+        }
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+    }
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+    // 2x2 * 2xn
+    if (true)
+    {
+        // 2x2 * 2x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 4x5 * 5x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
+        // 2x2 * 2x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
-
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 4x5 * 5x5 -> 4x5
-        if (_RowsA == 4 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
+        // 2x2 * 2x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
+            return;
+        }
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)) + (A.at(3, 4) * B.at(4, 4)));
+        // 2x2 * 2x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
 
             return;
         }
 
     }
 
-    // 5x5 * 5xn
+    // 3x2 * 2xn
     if (true)
     {
-        // 5x5 * 5x1 -> 5x1
-        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 1)
+        // 3x2 * 2x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
+            return;
+        }
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
+        // 3x2 * 2x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 5x5 * 5x2 -> 5x2
-        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 2)
+        // 3x2 * 2x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
+            return;
+        }
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
+        // 3x2 * 2x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
 
             return;
         }
 
-        // 5x5 * 5x3 -> 5x3
-        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
+    }
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
+    // 4x2 * 2xn
+    if (true)
+    {
+        // 4x2 * 2x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 5x5 * 5x4 -> 5x4
-        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 4)
+        // 4x2 * 2x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)) + (A.at(4, 4) * B.at(4, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 5x5 * 5x5 -> 5x5
-        if (_RowsA == 5 and _ColsA == 5 and _RowsB == 5 and _ColsB == 5)
+        // 4x2 * 2x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)) + (A.at(0, 4) * B.at(4, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)) + (A.at(0, 4) * B.at(4, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)) + (A.at(0, 4) * B.at(4, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)) + (A.at(0, 4) * B.at(4, 3)));
-            C.at(0, 4) = _ElemC((A.at(0, 0) * B.at(0, 4)) + (A.at(0, 1) * B.at(1, 4)) + (A.at(0, 2) * B.at(2, 4)) + (A.at(0, 3) * B.at(3, 4)) + (A.at(0, 4) * B.at(4, 4)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)) + (A.at(1, 4) * B.at(4, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)) + (A.at(1, 4) * B.at(4, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)) + (A.at(1, 4) * B.at(4, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)) + (A.at(1, 4) * B.at(4, 3)));
-            C.at(1, 4) = _ElemC((A.at(1, 0) * B.at(0, 4)) + (A.at(1, 1) * B.at(1, 4)) + (A.at(1, 2) * B.at(2, 4)) + (A.at(1, 3) * B.at(3, 4)) + (A.at(1, 4) * B.at(4, 4)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)) + (A.at(2, 4) * B.at(4, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)) + (A.at(2, 4) * B.at(4, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)) + (A.at(2, 4) * B.at(4, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)) + (A.at(2, 4) * B.at(4, 3)));
-            C.at(2, 4) = _ElemC((A.at(2, 0) * B.at(0, 4)) + (A.at(2, 1) * B.at(1, 4)) + (A.at(2, 2) * B.at(2, 4)) + (A.at(2, 3) * B.at(3, 4)) + (A.at(2, 4) * B.at(4, 4)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)) + (A.at(3, 4) * B.at(4, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)) + (A.at(3, 4) * B.at(4, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)) + (A.at(3, 4) * B.at(4, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)) + (A.at(3, 4) * B.at(4, 3)));
-            C.at(3, 4) = _ElemC((A.at(3, 0) * B.at(0, 4)) + (A.at(3, 1) * B.at(1, 4)) + (A.at(3, 2) * B.at(2, 4)) + (A.at(3, 3) * B.at(3, 4)) + (A.at(3, 4) * B.at(4, 4)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
 
-            C.at(4, 0) = _ElemC((A.at(4, 0) * B.at(0, 0)) + (A.at(4, 1) * B.at(1, 0)) + (A.at(4, 2) * B.at(2, 0)) + (A.at(4, 3) * B.at(3, 0)) + (A.at(4, 4) * B.at(4, 0)));
-            C.at(4, 1) = _ElemC((A.at(4, 0) * B.at(0, 1)) + (A.at(4, 1) * B.at(1, 1)) + (A.at(4, 2) * B.at(2, 1)) + (A.at(4, 3) * B.at(3, 1)) + (A.at(4, 4) * B.at(4, 1)));
-            C.at(4, 2) = _ElemC((A.at(4, 0) * B.at(0, 2)) + (A.at(4, 1) * B.at(1, 2)) + (A.at(4, 2) * B.at(2, 2)) + (A.at(4, 3) * B.at(3, 2)) + (A.at(4, 4) * B.at(4, 2)));
-            C.at(4, 3) = _ElemC((A.at(4, 0) * B.at(0, 3)) + (A.at(4, 1) * B.at(1, 3)) + (A.at(4, 2) * B.at(2, 3)) + (A.at(4, 3) * B.at(3, 3)) + (A.at(4, 4) * B.at(4, 3)));
-            C.at(4, 4) = _ElemC((A.at(4, 0) * B.at(0, 4)) + (A.at(4, 1) * B.at(1, 4)) + (A.at(4, 2) * B.at(2, 4)) + (A.at(4, 3) * B.at(3, 4)) + (A.at(4, 4) * B.at(4, 4)));
+            return;
+        }
+
+        // 4x2 * 2x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
 
             return;
         }
 
     }
 
-    // Matrices n1x5 * 5xn2
-    if (_ColsA == 5 and _RowsB == 5)
+    // Matrices n1x2 * 2xn2
+    if (_ColsA == 2 and _RowsB == 2)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)) + (A.at(rows, 4) * B.at(4, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
         return;
     }
-#elif defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 3)
-#pragma message ("Compiling Matrix2D unrolled multiplication function for up to 4x4")
+
+    // 1x3 * 3xn
     if (true)
     {
-        // 1x1 * 1x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 1x3 * 3x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 1x1 * 1x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 1x3 * 3x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 1x1 * 1x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 1x3 * 3x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 1x1 * 1x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 1x3 * 3x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
             return;
         }
 
     }
 
-    // 2x1 * 1xn
+    // 2x3 * 3xn
     if (true)
-    {
-        // 2x1 * 1x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+    {
+        // 2x3 * 3x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 2x1 * 1x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 2x3 * 3x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 2x1 * 1x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 2x3 * 3x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 2x1 * 1x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 2x3 * 3x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
             return;
         }
 
     }
 
-    // 3x1 * 1xn
+    // 3x3 * 3xn
     if (true)
     {
-        // 3x1 * 1x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 3x3 * 3x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 3x1 * 1x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 3x3 * 3x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 3x1 * 1x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 3x3 * 3x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 3x1 * 1x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 3x3 * 3x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
 
             return;
         }
 
     }
 
-    // 4x1 * 1xn
+    // 4x3 * 3xn
     if (true)
     {
-        // 4x1 * 1x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
+        // 4x3 * 3x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 4x1 * 1x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
+        // 4x3 * 3x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 4x1 * 1x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
+        // 4x3 * 3x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 4x1 * 1x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 1 and _RowsB == 1 and _ColsB == 4)
+        // 4x3 * 3x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
 
             return;
         }
 
     }
 
-    // Matrices n1x1 * 1xn2
-    if (_ColsA == 1 and _RowsB == 1)
+    // Matrices n1x3 * 3xn2
+    if (_ColsA == 3 and _RowsB == 3)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
         return;
     }
 
-    // 1x2 * 2xn
+    // 1x4 * 4xn
     if (true)
     {
-        // 1x2 * 2x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 1x4 * 4x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 1x2 * 2x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 1x4 * 4x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 1x2 * 2x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 1x4 * 4x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 1x2 * 2x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 1x4 * 4x4 -> 1x4
+        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
             return;
         }
 
     }
 
-    // 2x2 * 2xn
+    // 2x4 * 4xn
     if (true)
     {
-        // 2x2 * 2x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 2x4 * 4x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 2x2 * 2x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 2x4 * 4x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 2x2 * 2x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 2x4 * 4x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 2x2 * 2x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 2x4 * 4x4 -> 2x4
+        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
             return;
         }
 
     }
 
-    // 3x2 * 2xn
+    // 3x4 * 4xn
     if (true)
     {
-        // 3x2 * 2x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 3x4 * 4x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 3x2 * 2x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 3x4 * 4x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 3x2 * 2x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 3x4 * 4x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 3x2 * 2x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 3x4 * 4x4 -> 3x4
+        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
             return;
         }
 
     }
 
-    // 4x2 * 2xn
+    // 4x4 * 4xn
     if (true)
     {
-        // 4x2 * 2x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        // 4x4 * 4x1 -> 4x1
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
 
             return;
         }
 
-        // 4x2 * 2x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        // 4x4 * 4x2 -> 4x2
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
 
             return;
         }
 
-        // 4x2 * 2x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        // 4x4 * 4x3 -> 4x3
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
 
             return;
         }
 
-        // 4x2 * 2x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 2 and _RowsB == 2 and _ColsB == 4)
+        // 4x4 * 4x4 -> 4x4
+        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)));
+            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
 
             return;
         }
 
     }
-
-    // Matrices n1x2 * 2xn2
-    if (_ColsA == 2 and _RowsB == 2)
+
+    // Matrices n1x4 * 4xn2
+    if (_ColsA == 4 and _RowsB == 4)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)));
         return;
     }
 
-    // 1x3 * 3xn
+#elif (defined(_MATRIX_MANUAL_OPTIMISATION) && !defined(NDEBUG)) or (defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 2)) 
+#pragma message ("Compiling Matrix2D unrolled multiplication function for up to 3x3")
+    // Smaller amount of functions for Debug Mode or explicit release mode
+
+    // 1x1 * 1xn
     if (true)
     {
-        // 1x3 * 3x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-
-            return;
-        }
-
-        // 1x3 * 3x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 1x1 * 1x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
             return;
         }
 
-        // 1x3 * 3x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 1x1 * 1x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 1x3 * 3x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 1x1 * 1x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
             return;
         }
 
     }
 
-    // 2x3 * 3xn
+    // 2x1 * 1xn
     if (true)
     {
-        // 2x3 * 3x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 2x1 * 1x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
 
             return;
         }
 
-        // 2x3 * 3x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 2x1 * 1x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 2x3 * 3x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+        // 2x1 * 1x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
             return;
         }
 
-        // 2x3 * 3x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+    }
+
+    // 3x1 * 1xn
+    if (true)
+    {
+        // 3x1 * 1x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
 
             return;
         }
 
-    }
-
-    // 3x3 * 3xn
-    if (true)
-    {
-        // 3x3 * 3x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 3x1 * 1x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
 
             return;
         }
 
-        // 3x3 * 3x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 3x1 * 1x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
 
             return;
         }
 
-        // 3x3 * 3x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+    }
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+    // Matrices n1x1 * 1xn2
+    if (_ColsA == 1 and _RowsB == 1)
+    {
+        for (size_t rows = 0; rows < _RowsC; rows++)
+            for (size_t cols = 0; cols < _ColsC; cols++)
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
+        return;
+    }
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+    // 1x2 * 2xn
+    if (true)
+    {
+        // 1x2 * 2x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 3x3 * 3x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 1x2 * 2x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            return;
+        }
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+        // 1x2 * 2x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
             return;
         }
 
     }
 
-    // 4x3 * 3xn
+    // 2x2 * 2xn
     if (true)
     {
-        // 4x3 * 3x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
+        // 2x2 * 2x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
 
             return;
         }
 
-        // 4x3 * 3x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
+        // 2x2 * 2x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            return;
+        }
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
+        // 2x2 * 2x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
             return;
         }
 
-        // 4x3 * 3x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
+    }
+
+    // 3x2 * 2xn
+    if (true)
+    {
+        // 3x2 * 2x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+
+            return;
+        }
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+        // 3x2 * 2x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+        {
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
 
             return;
         }
 
-        // 4x3 * 3x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 3 and _RowsB == 3 and _ColsB == 4)
+        // 3x2 * 2x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
 
             return;
         }
 
     }
 
-    // Matrices n1x3 * 3xn2
-    if (_ColsA == 3 and _RowsB == 3)
+    // Matrices n1x2 * 2xn2
+    if (_ColsA == 2 and _RowsB == 2)
     {
         for (size_t rows = 0; rows < _RowsC; rows++)
             for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
         return;
     }
 
-    // 1x4 * 4xn
+    // 1x3 * 3xn
     if (true)
     {
-        // 1x4 * 4x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-
-            return;
-        }
-
-        // 1x4 * 4x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 1x3 * 3x1 -> 1x1
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 1x4 * 4x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 1x3 * 3x2 -> 1x2
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 1x4 * 4x4 -> 1x4
-        if (_RowsA == 1 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 1x3 * 3x3 -> 1x3
+        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
             return;
         }
 
     }
 
-    // 2x4 * 4xn
+    // 2x3 * 3xn
     if (true)
     {
-        // 2x4 * 4x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-
-            return;
-        }
-
-        // 2x4 * 4x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 2x3 * 3x1 -> 2x1
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 2x4 * 4x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 2x3 * 3x2 -> 2x2
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 2x4 * 4x4 -> 2x4
-        if (_RowsA == 2 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+        // 2x3 * 3x3 -> 2x3
+        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
             return;
         }
 
     }
 
-    // 3x4 * 4xn
+    // 3x3 * 3xn
     if (true)
     {
-        // 3x4 * 4x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
+        // 3x3 * 3x1 -> 3x1
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
 
             return;
         }
 
-        // 3x4 * 4x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
+        // 3x3 * 3x2 -> 3x2
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
 
             return;
         }
 
-        // 3x4 * 4x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+        // 3x3 * 3x3 -> 3x3
+        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
 
             return;
         }
 
-        // 3x4 * 4x4 -> 3x4
-        if (_RowsA == 3 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+    }
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+    // Matrices n1x3 * 3xn2
+    if (_ColsA == 3 and _RowsB == 3)
+    {
+        for (size_t rows = 0; rows < _RowsC; rows++)
+            for (size_t cols = 0; cols < _ColsC; cols++)
+                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
+        return;
+    }
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
 
-            return;
-        }
 
-    }
+#endif // _MATRIX_MANUAL_OPTIMISATION
 
-    // 4x4 * 4xn
-    if (true)
+    // If we don't use [_MATRIX_MANUAL_OPTIMISATION] or for matrices that don't fit
+    // into the cases describes for [_MATRIX_MANUAL_OPTIMISATION]:
+
+    // bigger matrices are multiplied by the packed kernel, which reads B sequentially
+    // and keeps a whole block of C in registers
+    if (_RowsA >= _MATRIX_PACKED_MUL_MIN_ROWS)
     {
-        // 4x4 * 4x1 -> 4x1
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
+        PackedMatrix<_ElemB, _RowsB, _ColsB, PackedOperand::Right> packedB(B);
+        Internal::MulPackedRight(&A[0], packedB.data(), &C[0], _RowsA, _ColsA, _ColsB);
+        return;
+    }
+
+    // clear destination for preparation
+    memset(&C[0], 0, _ColsC * _RowsC * sizeof(_ElemC));
+
+    // Now multiply all and add to corresponding index
+    for (size_t rowsA = 0, index = 0; rowsA < _RowsA; rowsA++)
+        for (size_t colsB = 0; colsB < _ColsB; colsB++, index++)
+            for (size_t rowCol = 0; rowCol < _ColsA; rowCol++)
+                C[index] += _ElemC(A.at(rowsA, rowCol) * B.at(rowCol, colsB));
+}
+
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, PackedMatrix<_ElemB, _ColsA, _ColsB, PackedOperand::Right>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    if ((void*)(&A) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+        "and input A is the same object as output C. If and input is the same as "
+        "an output, the multiplication may fail and give an invalid result!" << std::endl;
+
+    Internal::MulPackedRight(&A[0], B.data(), &C[0], _RowsA, _ColsA, _ColsB);
+}
+
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(PackedMatrix<_ElemA, _RowsA, _ColsA, PackedOperand::Left>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    if ((void*)(&B) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+        "and input B is the same object as output C. If and input is the same as "
+        "an output, the multiplication may fail and give an invalid result!" << std::endl;
+
+    Internal::MulPackedLeft(A.data(), &B[0], &C[0], _RowsA, _ColsA, _ColsB);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(const MatrixView<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    PackedMatrix<_ElemB, _ColsA, _ColsB, PackedOperand::Right> packedB(B);
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
+    // views from Reshape() already have the layout of a matrix, unless they view C itself, e.g. Mul(X.Reshape<96, 96>(), X, X)
+    if (A.row_stride() == ptrdiff_t(_ColsA) and A.col_stride() == 1 and not Internal::Overlaps(A.base(), _RowsA * _ColsA, &C[0], _RowsA * _ColsB))
+    {
+        Internal::MulPackedRight(A.base(), packedB.data(), &C[0], _RowsA, _ColsA, _ColsB);
+        return;
+    }
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
+    // the kernel reads the rows of A many times, so A is copied once with the blocked transpose, which is faster
+    // than packing it into left panels. That copy is small compared to the multiplication.
+    std::vector<_ElemA> contiguousA(_RowsA * _ColsA);
+    Internal::CopyStrided(static_cast<const _ElemA*>(A.base()), A.row_stride(), A.col_stride(), contiguousA.data(), _RowsA, _ColsA);
+    Internal::MulPackedRight(contiguousA.data(), packedB.data(), &C[0], _RowsA, _ColsA, _ColsB);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(Matrix2D<_ElemA, _RowsA, _ColsA>& A, const MatrixView<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    if ((void*)(&A) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+        "and input A is the same object as output C. If and input is the same as "
+        "an output, the multiplication may fail and give an invalid result!" << std::endl;
+
+    // B is packed anyway, so the view only changes where the packing reads from, and a view of C is fine
+    std::vector<_ElemB> packedB(PackedMatrix<_ElemB, _ColsA, _ColsB, PackedOperand::Right>::c_elements);
+    Internal::PackRightOperandStrided(B.base(), B.row_stride(), B.col_stride(), _ColsA, _ColsB, packedB.data());
+    Internal::MulPackedRight(&A[0], packedB.data(), &C[0], _RowsA, _ColsA, _ColsB);
+}
 
-        // 4x4 * 4x2 -> 4x2
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _ColsB, typename _ElemC>
+void Matrix::Mul(const MatrixView<_ElemA, _RowsA, _ColsA>& A, const MatrixView<_ElemB, _ColsA, _ColsB>& B, Matrix2D<_ElemC, _RowsA, _ColsB>& C)
+{
+    // both views are copied before C is written, so they may view C
+    std::vector<_ElemA> contiguousA(_RowsA * _ColsA);
+    Internal::CopyStrided(static_cast<const _ElemA*>(A.base()), A.row_stride(), A.col_stride(), contiguousA.data(), _RowsA, _ColsA);
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
+    std::vector<_ElemB> packedB(PackedMatrix<_ElemB, _ColsA, _ColsB, PackedOperand::Right>::c_elements);
+    Internal::PackRightOperandStrided(B.base(), B.row_stride(), B.col_stride(), _ColsA, _ColsB, packedB.data());
+    Internal::MulPackedRight(contiguousA.data(), packedB.data(), &C[0], _RowsA, _ColsA, _ColsB);
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+{
+    Internal::Elementwise<Internal::OpAdd>(&A[0], &B[0], &C[0], _Rows * _Cols);
+}
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(A[i] + scalar);
+        });
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+{
+    Internal::Elementwise<Internal::OpSub>(&A[0], &B[0], &C[0], _Rows * _Cols);
+}
 
-        // 4x4 * 4x3 -> 4x3
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 3)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(A[i] - scalar);
+        });
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::Sub(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(scalar - A[i]);
+        });
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+{
+    Internal::Elementwise<Internal::OpMul>(&A[0], &B[0], &C[0], _Rows * _Cols);
+}
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(A[i] * scalar);
+        });
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+{
+    Internal::Elementwise<Internal::OpDiv>(&A[0], &B[0], &C[0], _Rows * _Cols);
+}
 
-        // 4x4 * 4x4 -> 4x4
-        if (_RowsA == 4 and _ColsA == 4 and _RowsB == 4 and _ColsB == 4)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)) + (A.at(0, 3) * B.at(3, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)) + (A.at(0, 3) * B.at(3, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)) + (A.at(0, 3) * B.at(3, 2)));
-            C.at(0, 3) = _ElemC((A.at(0, 0) * B.at(0, 3)) + (A.at(0, 1) * B.at(1, 3)) + (A.at(0, 2) * B.at(2, 3)) + (A.at(0, 3) * B.at(3, 3)));
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(A[i] / scalar);
+        });
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)) + (A.at(1, 3) * B.at(3, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)) + (A.at(1, 3) * B.at(3, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)) + (A.at(1, 3) * B.at(3, 2)));
-            C.at(1, 3) = _ElemC((A.at(1, 0) * B.at(0, 3)) + (A.at(1, 1) * B.at(1, 3)) + (A.at(1, 2) * B.at(2, 3)) + (A.at(1, 3) * B.at(3, 3)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::DivEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B)
+{
+    Internal::ParallelElements<_ElemC>(_Rows * _Cols, [&](const size_t begin, const size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                B[i] = _ElemC(scalar / A[i]);
+        });
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)) + (A.at(2, 3) * B.at(3, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)) + (A.at(2, 3) * B.at(3, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)) + (A.at(2, 3) * B.at(3, 2)));
-            C.at(2, 3) = _ElemC((A.at(2, 0) * B.at(0, 3)) + (A.at(2, 1) * B.at(1, 3)) + (A.at(2, 2) * B.at(2, 3)) + (A.at(2, 3) * B.at(3, 3)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type>
+void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastRow<Internal::OpAdd>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-            C.at(3, 0) = _ElemC((A.at(3, 0) * B.at(0, 0)) + (A.at(3, 1) * B.at(1, 0)) + (A.at(3, 2) * B.at(2, 0)) + (A.at(3, 3) * B.at(3, 0)));
-            C.at(3, 1) = _ElemC((A.at(3, 0) * B.at(0, 1)) + (A.at(3, 1) * B.at(1, 1)) + (A.at(3, 2) * B.at(2, 1)) + (A.at(3, 3) * B.at(3, 1)));
-            C.at(3, 2) = _ElemC((A.at(3, 0) * B.at(0, 2)) + (A.at(3, 1) * B.at(1, 2)) + (A.at(3, 2) * B.at(2, 2)) + (A.at(3, 3) * B.at(3, 2)));
-            C.at(3, 3) = _ElemC((A.at(3, 0) * B.at(0, 3)) + (A.at(3, 1) * B.at(1, 3)) + (A.at(3, 2) * B.at(2, 3)) + (A.at(3, 3) * B.at(3, 3)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type>
+void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastCol<Internal::OpAdd>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type>
+void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastRow<Internal::OpSub>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type>
+void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastCol<Internal::OpSub>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-    // Matrices n1x4 * 4xn2
-    if (_ColsA == 4 and _RowsB == 4)
-    {
-        for (size_t rows = 0; rows < _RowsC; rows++)
-            for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)) + (A.at(rows, 3) * B.at(3, cols)));
-        return;
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type>
+void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastRow<Internal::OpMul>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-#elif (defined(_MATRIX_MANUAL_OPTIMISATION) && !defined(NDEBUG)) or (defined(_MATRIX_MANUAL_OPTIMISATION) && defined(NDEBUG) && (_MATRIX_LIMIT_MANUAL_OPTIMISATION_TO_N > 2)) 
-#pragma message ("Compiling Matrix2D unrolled multiplication function for up to 3x3")
-    // Smaller amount of functions for Debug Mode or explicit release mode
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type>
+void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastCol<Internal::OpMul>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-    // 1x1 * 1xn
-    if (true)
-    {
-        // 1x1 * 1x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Rows > 1), int>::type>
+void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastRow<Internal::OpDiv>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename std::enable_if<(_Cols > 1), int>::type>
+void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::BroadcastCol<Internal::OpDiv>(&A[0], &B[0], &C[0], _Rows, _Cols);
+}
 
-        // 1x1 * 1x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C, const Accuracy accuracy)
+{
+    Internal::Pow(Internal::ArrayOperand<_ElemA>{ &A[0] }, Internal::ArrayOperand<_ElemB>{ &B[0] }, &C[0], _Rows * _Cols, accuracy);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Pow(Internal::ArrayOperand<_ElemA>{ &A[0] }, Internal::ScalarOperand<_ElemB>{ scalar }, &B[0], _Rows * _Cols, accuracy);
+}
 
-        // 1x1 * 1x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
+void Matrix::PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Pow(Internal::ScalarOperand<_ElemA>{ scalar }, Internal::ArrayOperand<_ElemB>{ &A[0] }, &B[0], _Rows * _Cols, accuracy);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnExp>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::LogEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnLog>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-    // 2x1 * 1xn
-    if (true)
-    {
-        // 2x1 * 1x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnSqrt>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::RsqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnRsqrt>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::TanhEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnTanh>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-        // 2x1 * 1x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::SigmoidEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, const Accuracy accuracy)
+{
+    Internal::Transcendental<Internal::FnSigmoid>(&A[0], &B[0], _Rows * _Cols, accuracy);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+void Matrix::SetDefaultAccuracy(const Accuracy accuracy)
+{
+    Internal::DefaultAccuracy() = (accuracy == Accuracy::Default) ? Accuracy::_MATRIX_DEFAULT_ACCURACY : accuracy;
+}
 
-            return;
-        }
+Matrix::Accuracy Matrix::GetDefaultAccuracy(void)
+{
+    return Internal::DefaultAccuracy();
+}
 
-        // 2x1 * 1x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+void Matrix::SetParallelThreshold(const size_t elements)
+{
+    Internal::ParallelThreshold() = (elements == 0) ? size_t(_MATRIX_PARALLEL_THRESHOLD) : elements;
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+size_t Matrix::GetParallelThreshold(void)
+{
+    return Internal::ParallelThreshold();
+}
 
-            return;
-        }
+void Matrix::SetStreamingStores(const StreamingStores mode)
+{
+    Internal::StreamingStoresMode() = mode;
+}
 
-    }
+Matrix::StreamingStores Matrix::GetStreamingStores(void)
+{
+    return Internal::StreamingStoresMode();
+}
 
-    // 3x1 * 1xn
-    if (true)
-    {
-        // 3x1 * 1x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::SumType<_Elem> Matrix::Sum(Matrix2D<_Elem, _Rows, _Cols>& A, const Summation summation)
+{
+    return Internal::Reduce<SumType<_Elem>, Internal::ReduceValue>(_Rows * _Cols, summation, &A[0]);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+_Elem Matrix::Min(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    static_assert(std::is_arithmetic<_Elem>::value, "MATRIX ASSERT: Min() needs an arithmetic element type!");
+    return Internal::Extreme<Internal::ExtremeMin, Internal::ReduceValue>(&A[0], _Rows * _Cols);
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+_Elem Matrix::Max(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    static_assert(std::is_arithmetic<_Elem>::value, "MATRIX ASSERT: Max() needs an arithmetic element type!");
+    return Internal::Extreme<Internal::ExtremeMax, Internal::ReduceValue>(&A[0], _Rows * _Cols);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+size_t Matrix::ArgMin(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    typedef std::integral_constant<bool, Internal::FusedSimd<_Elem, _Elem>::c_value> _Simd;
+    return Internal::FindFirst(&A[0], _Rows * _Cols, Matrix::Min(A), _Simd());
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+size_t Matrix::ArgMax(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    typedef std::integral_constant<bool, Internal::FusedSimd<_Elem, _Elem>::c_value> _Simd;
+    return Internal::FindFirst(&A[0], _Rows * _Cols, Matrix::Max(A), _Simd());
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+Matrix::SumType<decltype(std::declval<_ElemA>() * std::declval<_ElemB>())> Matrix::Dot(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Summation summation)
+{
+    typedef SumType<decltype(std::declval<_ElemA>() * std::declval<_ElemB>())> _Calc;
+    return Internal::Reduce<_Calc, Internal::ReduceProduct>(_Rows * _Cols, summation, &A[0], &B[0]);
+}
 
-        // 3x1 * 1x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::NormResult<_Elem> Matrix::Norm(Matrix2D<_Elem, _Rows, _Cols>& A, const NormType type, const Summation summation)
+{
+    static_assert(std::is_arithmetic<_Elem>::value, "MATRIX ASSERT: Norm() needs an arithmetic element type!");
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
+    // integers are converted to double before they are squared, so they can't overflow
+    typedef NormResult<_Elem> _Calc;
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
+    switch (type)
+    {
+    case NormType::L1:
+        return Internal::Reduce<_Calc, Internal::ReduceAbs>(_Rows * _Cols, summation, &A[0]);
+    case NormType::Inf:
+        if (std::is_floating_point<_Elem>::value)
+            return _Calc(Internal::Extreme<Internal::ExtremeMax, Internal::ReduceAbs>(&A[0], _Rows * _Cols));
+
+        // -INT_MIN doesn't fit an int, so integers take the absolute value of their extremes in double
+        return std::max(std::abs(_Calc(Internal::Extreme<Internal::ExtremeMin, Internal::ReduceValue>(&A[0], _Rows * _Cols))),
+            std::abs(_Calc(Internal::Extreme<Internal::ExtremeMax, Internal::ReduceValue>(&A[0], _Rows * _Cols))));
+    default:
+        return std::sqrt(Internal::Reduce<_Calc, Internal::ReduceSquare>(_Rows * _Cols, summation, &A[0]));
+    }
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::ReduceRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, 1>& B, const Reduction reduction)
+{
+    typedef SumType<_ElemA> _Sum;
+    typedef NormResult<_ElemA> _Norm;
+    typedef std::integral_constant<bool, std::is_floating_point<_Sum>::value> _FloatingSum;
+    typedef std::integral_constant<bool, std::is_floating_point<_Norm>::value> _FloatingNorm;
+    typedef std::integral_constant<bool, Internal::FusedSimd<_Sum, _Sum, _ElemA>::c_value> _SimdSum;
+    typedef std::integral_constant<bool, Internal::FusedSimd<_Norm, _Norm, _ElemA>::c_value> _SimdNorm;
+    typedef std::integral_constant<bool, Internal::FusedSimd<_ElemA, _ElemA>::c_value> _SimdExtreme;
 
-        // 3x1 * 1x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 1 and _RowsB == 1 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)));
+    static_assert(std::is_arithmetic<_ElemA>::value, "MATRIX ASSERT: ReduceRows() needs an arithmetic element type!");
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)));
+    switch (reduction)
+    {
+    case Reduction::Mean:
+        Internal::ReduceEachRow(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* row)
+            {
+                return _Norm(Internal::SumRange<_Sum, Internal::ReduceValue>(_Cols, Summation::Fast, _FloatingSum(), _SimdSum(), row)) / _Norm(_Cols);
+            });
+        break;
+    case Reduction::Min:
+        Internal::ReduceEachRow(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* row)
+            {
+                return Internal::ExtremeRange<Internal::ExtremeMin, Internal::ReduceValue>(row, _Cols, _SimdExtreme());
+            });
+        break;
+    case Reduction::Max:
+        Internal::ReduceEachRow(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* row)
+            {
+                return Internal::ExtremeRange<Internal::ExtremeMax, Internal::ReduceValue>(row, _Cols, _SimdExtreme());
+            });
+        break;
+    case Reduction::Norm:
+        Internal::ReduceEachRow(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* row)
+            {
+                return std::sqrt(Internal::SumRange<_Norm, Internal::ReduceSquare>(_Cols, Summation::Fast, _FloatingNorm(), _SimdNorm(), row));
+            });
+        break;
+    default:
+        Internal::ReduceEachRow(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* row)
+            {
+                return Internal::SumRange<_Sum, Internal::ReduceValue>(_Cols, Summation::Fast, _FloatingSum(), _SimdSum(), row);
+            });
+        break;
+    }
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::ReduceCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, 1, _Cols>& B, const Reduction reduction)
+{
+    typedef SumType<_ElemA> _Sum;
+    typedef NormResult<_ElemA> _Norm;
 
-            return;
-        }
+    static_assert(std::is_arithmetic<_ElemA>::value, "MATRIX ASSERT: ReduceCols() needs an arithmetic element type!");
 
+    switch (reduction)
+    {
+    case Reduction::Min:
+    case Reduction::Max:
+    {
+        std::vector<_ElemA> acc(_Cols);
+        if (reduction == Reduction::Min)
+            Internal::AccumulateCols<Internal::AccumulateExtreme<Internal::ExtremeMin>>(acc.data(), &A[0], _Rows, _Cols);
+        else
+            Internal::AccumulateCols<Internal::AccumulateExtreme<Internal::ExtremeMax>>(acc.data(), &A[0], _Rows, _Cols);
+        for (size_t col = 0; col < _Cols; col++)
+            B[col] = _ElemB(acc[col]);
+        break;
     }
-
-    // Matrices n1x1 * 1xn2
-    if (_ColsA == 1 and _RowsB == 1)
+    case Reduction::Norm:
     {
-        for (size_t rows = 0; rows < _RowsC; rows++)
-            for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)));
-        return;
+        std::vector<_Norm> acc(_Cols);
+        Internal::AccumulateCols<Internal::AccumulateSum<Internal::ReduceSquare>>(acc.data(), &A[0], _Rows, _Cols);
+        for (size_t col = 0; col < _Cols; col++)
+            B[col] = _ElemB(std::sqrt(acc[col]));
+        break;
     }
-
-    // 1x2 * 2xn
-    if (true)
+    default:
     {
-        // 1x2 * 2x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+        std::vector<_Sum> acc(_Cols);
+        Internal::AccumulateCols<Internal::AccumulateSum<Internal::ReduceValue>>(acc.data(), &A[0], _Rows, _Cols);
+        for (size_t col = 0; col < _Cols; col++)
+            B[col] = (reduction == Reduction::Mean) ? _ElemB(_Norm(acc[col]) / _Norm(_Rows)) : _ElemB(acc[col]);
+        break;
+    }
+    }
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+bool Matrix::ApproxEqual(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const double abs_tolerance, const double rel_tolerance)
+{
+    static_assert(std::is_arithmetic<_ElemA>::value and std::is_arithmetic<_ElemB>::value, "MATRIX ASSERT: ApproxEqual() needs arithmetic element types!");
 
-        // 1x2 * 2x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
+    // integers are compared in double
+    typedef NormResult<decltype(std::declval<_ElemA>() - std::declval<_ElemB>())> _Calc;
+    typedef std::integral_constant<bool, Internal::FusedSimd<_Calc, _Calc, _ElemA, _ElemB>::c_value> _Simd;
+
+    const _ElemA* a = &A[0];
+    const _ElemB* b = &B[0];
+    return Internal::ParallelReduce<_Calc, bool>(_Rows * _Cols, [=](const size_t begin, const size_t end)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+            return Internal::ApproxEqualRange(a + begin, b + begin, end - begin, _Calc(abs_tolerance), _Calc(rel_tolerance), _Simd());
+        },
+        [](const bool x, const bool y) { return x and y; });
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+bool Matrix::ApproxEqualUlps(Matrix2D<_Elem, _Rows, _Cols>& A, Matrix2D<_Elem, _Rows, _Cols>& B, const uint64_t max_ulps)
+{
+    static_assert(std::is_floating_point<_Elem>::value and sizeof(_Elem) <= 8, "MATRIX ASSERT: ApproxEqualUlps() needs float or double matrices!");
 
-        // 1x2 * 2x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
+    typedef Internal::UlpBits<_Elem> _Bits;
+    const _Bits ulps = _Bits(std::min<uint64_t>(max_ulps, std::numeric_limits<_Bits>::max() >> 2));
+
+    const _Elem* a = &A[0];
+    const _Elem* b = &B[0];
+    return Internal::ParallelReduce<_Elem, bool>(_Rows * _Cols, [=](const size_t begin, const size_t end)
         {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+#ifdef _MATRIX_SIMD_AVX2
+            return Internal::ApproxEqualUlpsSimd(a + begin, b + begin, end - begin, ulps);
+#else
+            return Internal::ApproxEqualUlpsRange(a + begin, b + begin, end - begin, ulps);
+#endif // _MATRIX_SIMD_AVX2
+        },
+        [](const bool x, const bool y) { return x and y; });
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+uint64_t Matrix::Hash(Matrix2D<_Elem, _Rows, _Cols>& A, const uint64_t seed)
+{
+    static_assert(std::is_trivially_copyable<_Elem>::value, "MATRIX ASSERT: Hash() needs a trivially copyable element type!");
+    return Internal::XXH64::Hash(reinterpret_cast<const unsigned char*>(&A[0]), _Rows * _Cols * sizeof(_Elem), seed);
+}
 
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Compare(Matrix2D<_ElemA, _Rows, _Cols>& A, const Comparison comparison, Matrix2D<_ElemB, _Rows, _Cols>& B, Mask2D<_Rows, _Cols>& mask)
+{
+    Internal::CompareWords(mask.data(), _Rows * _Cols, &A[0], &B[0], 64, comparison);
+}
 
-    // 2x2 * 2xn
-    if (true)
-    {
-        // 2x2 * 2x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Compare(Matrix2D<_ElemA, _Rows, _Cols>& A, const Comparison comparison, const _ElemB scalar, Mask2D<_Rows, _Cols>& mask)
+{
+    typedef decltype(std::declval<_ElemA>() + scalar) _Exact;
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+    // Float matrices use the SIMD kernel with a float scalar. A double scalar that float can't represent moves
+    // the comparison to its neighbouring float, so the result stays the one of A(i) [comparison] scalar in double.
+    typedef typename std::conditional<std::is_floating_point<_ElemA>::value, _ElemA, _Exact>::type _Calc;
 
-            return;
-        }
+    Comparison calc_comparison = comparison;
+    _Calc threshold = _Calc(scalar);
+    if (_Exact(threshold) != _Exact(scalar) and _Exact(scalar) == _Exact(scalar))
+        Internal::NarrowComparison(_Exact(scalar), calc_comparison, threshold, std::integral_constant<bool, std::is_floating_point<_Calc>::value>());
 
-        // 2x2 * 2x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+    _Calc block[64];
+    std::fill(block, block + 64, threshold);
+    Internal::CompareWords(mask.data(), _Rows * _Cols, &A[0], static_cast<const _Calc*>(block), 0, calc_comparison);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB, typename _ElemC>
+void Matrix::Where(Mask2D<_Rows, _Cols>& mask, Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::Select(mask.data(), _Rows * _Cols, &A[0], 64, &B[0], &C[0]);
+}
 
-            return;
-        }
+template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB>
+void Matrix::MaskedAssign(Mask2D<_Rows, _Cols>& mask, Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    Internal::Select(mask.data(), _Rows * _Cols, &A[0], 64, &B[0], &B[0]);
+}
 
-        // 2x2 * 2x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+template<size_t _Rows, size_t _Cols, typename _ElemA, typename _ElemB>
+void Matrix::MaskedAssign(Mask2D<_Rows, _Cols>& mask, const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    _ElemB block[64];
+    std::fill(block, block + 64, _ElemB(scalar));
+    Internal::Select(mask.data(), _Rows * _Cols, static_cast<const _ElemB*>(block), 0, &B[0], &B[0]);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+template<size_t _Rows, size_t _Cols>
+size_t Matrix::CountTrue(Mask2D<_Rows, _Cols>& mask)
+{
+    const uint64_t* words = mask.data();
 
-            return;
-        }
+    size_t count = 0;
+    for (size_t word = 0; word < Mask2D<_Rows, _Cols>::c_words; word++)
+        count += Internal::PopCount(words[word]);
+    return count;
+}
 
-    }
+template<size_t _Rows, size_t _Cols>
+void Matrix::MaskedIndices(Mask2D<_Rows, _Cols>& mask, std::vector<size_t>& indices)
+{
+    const uint64_t* words = mask.data();
 
-    // 3x2 * 2xn
-    if (true)
-    {
-        // 3x2 * 2x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
+    indices.resize(CountTrue(mask));
+    size_t* out = indices.data();
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
+    for (size_t word = 0; word < Mask2D<_Rows, _Cols>::c_words; word++)
+        for (uint64_t bits = words[word]; bits != 0; bits &= bits - 1)
+            *out++ = (word * 64) + Internal::TrailingZeros(bits);
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _Func, typename _ElemB>
+void Matrix::Map(Matrix2D<_ElemA, _Rows, _Cols>& A, _Func f, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    Internal::Zip(&B[0], _Rows * _Cols, f, &A[0]);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _Func, typename _ElemC>
+void Matrix::ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, _Func f, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    Internal::Zip(&C[0], _Rows * _Cols, f, &A[0], &B[0]);
+}
 
-        // 3x2 * 2x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _Func, typename _ElemD>
+void Matrix::ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, _Func f, Matrix2D<_ElemD, _Rows, _Cols>& D)
+{
+    Internal::Zip(&D[0], _Rows * _Cols, f, &A[0], &B[0], &C[0]);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _ElemD, typename _Func, typename _ElemE>
+void Matrix::ZipWith(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, Matrix2D<_ElemD, _Rows, _Cols>& D, _Func f, Matrix2D<_ElemE, _Rows, _Cols>& E)
+{
+    Internal::Zip(&E[0], _Rows * _Cols, f, &A[0], &B[0], &C[0], &D[0]);
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC, typename _ElemD>
+void Matrix::FmaEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C, Matrix2D<_ElemD, _Rows, _Cols>& D)
+{
+    typedef decltype(A[0] * B[0] + C[0]) _Calc;
+    Internal::Fused<_Calc>(&D[0], _Rows * _Cols, Internal::OpFma<_Calc>(), &A[0], &B[0], &C[0]);
+}
 
-            return;
-        }
+template<typename _Alpha, typename _ElemX, size_t _Rows, size_t _Cols, typename _ElemY>
+void Matrix::Axpy(const _Alpha alpha, Matrix2D<_ElemX, _Rows, _Cols>& X, Matrix2D<_ElemY, _Rows, _Cols>& Y)
+{
+    typedef typename Internal::FusedCalc<decltype(X[0] + Y[0]), decltype(alpha * X[0] + Y[0])>::_Type _Calc;
+    Internal::Fused<_Calc>(&Y[0], _Rows * _Cols, Internal::OpAxpy<_Calc>{ _Calc(alpha) }, &X[0], &Y[0]);
+}
 
-        // 3x2 * 2x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 2 and _RowsB == 2 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)));
+template<typename _Alpha, typename _ElemX, size_t _Rows, size_t _Cols, typename _Beta, typename _ElemY>
+void Matrix::Axpby(const _Alpha alpha, Matrix2D<_ElemX, _Rows, _Cols>& X, const _Beta beta, Matrix2D<_ElemY, _Rows, _Cols>& Y)
+{
+    typedef typename Internal::FusedCalc<decltype(X[0] + Y[0]), decltype(alpha * X[0] + beta * Y[0])>::_Type _Calc;
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)));
+    // like in BLAS, beta = 0 doesn't read Y, so NaN and Inf in an uninitialized Y don't leak into the result
+    if (_Calc(beta) == _Calc(0))
+        Internal::Fused<_Calc>(&Y[0], _Rows * _Cols, Internal::OpScale<_Calc>{ _Calc(alpha) }, &X[0]);
+    else
+        Internal::Fused<_Calc>(&Y[0], _Rows * _Cols, Internal::OpAxpby<_Calc>{ _Calc(alpha), _Calc(beta) }, &X[0], &Y[0]);
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemT, typename _ElemC>
+void Matrix::LerpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const _ElemT t, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    typedef typename Internal::FusedCalc<decltype(A[0] + B[0]), decltype(A[0] + t * (B[0] - A[0]))>::_Type _Calc;
+    Internal::Fused<_Calc>(&C[0], _Rows * _Cols, Internal::OpLerp<_Calc>{ _Calc(t) }, &A[0], &B[0]);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemT, typename _ElemC>
+void Matrix::LerpEBE(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemT, _Rows, _Cols>& T, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    typedef decltype(A[0] + T[0] * (B[0] - A[0])) _Calc;
+    Internal::Fused<_Calc>(&C[0], _Rows * _Cols, Internal::OpLerp<_Calc>{ _Calc(0) }, &A[0], &B[0], &T[0]);
+}
 
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Transpose(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Cols, _Rows>& B)
+{
+    Internal::TransposeStrided(&A[0], ptrdiff_t(_Cols), &B[0], ptrdiff_t(_Rows), _Rows, _Cols);
+}
 
-    // Matrices n1x2 * 2xn2
-    if (_ColsA == 2 and _RowsB == 2)
-    {
-        for (size_t rows = 0; rows < _RowsC; rows++)
-            for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)));
-        return;
-    }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Transpose90deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Cols, _Rows>&B)
+{
+    // B(i, j) = A(_Rows - 1 - j, i), the transpose of A with its rows in reverse order
+    Internal::TransposeStrided(&A[(_Rows - 1) * _Cols], -ptrdiff_t(_Cols), &B[0], ptrdiff_t(_Rows), _Rows, _Cols);
+}
 
-    // 1x3 * 3xn
-    if (true)
-    {
-        // 1x3 * 3x1 -> 1x1
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Transpose180deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B)
+{
+    Internal::Reverse(&A[0], &B[0], _Rows * _Cols);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Transpose270deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Cols, _Rows>&B)
+{
+    // B(i, j) = A(j, _Cols - 1 - i), the transpose of A written to the rows of B in reverse order
+    Internal::TransposeStrided(&A[0], ptrdiff_t(_Cols), &B[(_Cols - 1) * _Rows], -ptrdiff_t(_Rows), _Rows, _Cols);
+}
+
+template<typename _Elem, size_t _Size>
+void Matrix::Transpose(Matrix2D<_Elem, _Size, _Size>& A)
+{
+    Internal::TransposeSquareInPlace(&A[0], _Size);
+}
 
-        // 1x3 * 3x2 -> 1x2
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+template<typename _Elem, size_t _Size>
+void Matrix::Transpose90deg(Matrix2D<_Elem, _Size, _Size>& A)
+{
+    // both passes stay contiguous, unlike swapping the four corners of every ring
+    Internal::TransposeSquareInPlace(&A[0], _Size);
+    Internal::ReverseEachRow(&A[0], _Size, _Size);
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+void Matrix::Transpose180deg(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    Internal::ReverseInPlace(&A[0], _Rows * _Cols);
+}
+
+template<typename _Elem, size_t _Size>
+void Matrix::Transpose270deg(Matrix2D<_Elem, _Size, _Size>& A)
+{
+    Internal::TransposeSquareInPlace(&A[0], _Size);
+    Internal::ReverseRowOrder(&A[0], _Size, _Size);
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Cols, _Rows> Matrix::TransposeInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A)
+{
+    Internal::TransposeInPlace(&A[0], _Rows, _Cols);
+    return Matrix2D<_Elem, _Cols, _Rows>(A.release());
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Cols, _Rows> Matrix::Transpose90degInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A)
+{
+    Internal::TransposeInPlace(&A[0], _Rows, _Cols);
+    Internal::ReverseEachRow(&A[0], _Cols, _Rows);
+    return Matrix2D<_Elem, _Cols, _Rows>(A.release());
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::Matrix2D<_Elem, _Cols, _Rows> Matrix::Transpose270degInPlace(Matrix2D<_Elem, _Rows, _Cols>&& A)
+{
+    Internal::TransposeInPlace(&A[0], _Rows, _Cols);
+    Internal::ReverseRowOrder(&A[0], _Cols, _Rows);
+    return Matrix2D<_Elem, _Cols, _Rows>(A.release());
+}
 
-        // 1x3 * 3x3 -> 1x3
-        if (_RowsA == 1 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::FlipHorizontal(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    Internal::CopyStrided(&A[_Cols - 1], ptrdiff_t(_Cols), -1, &B[0], _Rows, _Cols);
+}
 
-            return;
-        }
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::FlipVertical(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    Internal::CopyStrided(&A[(_Rows - 1) * _Cols], -ptrdiff_t(_Cols), 1, &B[0], _Rows, _Cols);
+}
 
-    }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+void Matrix::FlipHorizontal(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    Internal::ReverseEachRow(&A[0], _Rows, _Cols);
+}
 
-    // 2x3 * 3xn
-    if (true)
-    {
-        // 2x3 * 3x1 -> 2x1
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+void Matrix::FlipVertical(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    Internal::ReverseRowOrder(&A[0], _Rows, _Cols);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Cols, _Rows> Matrix::TransposedView(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    return MatrixView<_Elem, _Cols, _Rows>(&A[0], 1, ptrdiff_t(_Cols));
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Cols, _Rows> Matrix::TransposedView(const MatrixView<_Elem, _Rows, _Cols>& A)
+{
+    return MatrixView<_Elem, _Cols, _Rows>(A.base(), A.col_stride(), A.row_stride());
+}
 
-        // 2x3 * 3x2 -> 2x2
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Cols, _Rows> Matrix::Rotated90View(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    // (i, j) = A(_Rows - 1 - j, i)
+    return MatrixView<_Elem, _Cols, _Rows>(&A[(_Rows - 1) * _Cols], 1, -ptrdiff_t(_Cols));
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Rows, _Cols> Matrix::Rotated180View(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    return MatrixView<_Elem, _Rows, _Cols>(&A[(_Rows * _Cols) - 1], -ptrdiff_t(_Cols), -1);
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Cols, _Rows> Matrix::Rotated270View(Matrix2D<_Elem, _Rows, _Cols>& A)
+{
+    // (i, j) = A(j, _Cols - 1 - i)
+    return MatrixView<_Elem, _Cols, _Rows>(&A[_Cols - 1], -1, ptrdiff_t(_Cols));
+}
 
-        // 2x3 * 3x3 -> 2x3
-        if (_RowsA == 2 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Rows, _Cols> Matrix::FlippedView(Matrix2D<_Elem, _Rows, _Cols>& A, const Flip axis)
+{
+    if (axis == Flip::Horizontal)
+        return MatrixView<_Elem, _Rows, _Cols>(&A[_Cols - 1], ptrdiff_t(_Cols), -1);
+    return MatrixView<_Elem, _Rows, _Cols>(&A[(_Rows - 1) * _Cols], -ptrdiff_t(_Cols), 1);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Materialize(const MatrixView<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
+{
+    Internal::CopyStrided(static_cast<const _ElemA*>(A.base()), A.row_stride(), A.col_stride(), &B[0], _Rows, _Cols);
+}
 
-            return;
-        }
+template<typename _Elem, size_t _Rows, size_t _Cols, Matrix::PackedOperand _Operand>
+template<typename _ElemB>
+Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>::PackedMatrix(Matrix2D<_ElemB, _Rows, _Cols>& _source) :
+    p_pack(new _Elem[c_elements])
+{
+    Pack(_source);
+}
 
-    }
+template<typename _Elem, size_t _Rows, size_t _Cols, Matrix::PackedOperand _Operand>
+Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>::PackedMatrix(const PackedMatrix& _initilizer) :
+    p_pack(new _Elem[c_elements])
+{
+    memcpy(p_pack, _initilizer.p_pack, c_elements * sizeof(_Elem));
+}
 
-    // 3x3 * 3xn
-    if (true)
-    {
-        // 3x3 * 3x1 -> 3x1
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 1)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols, Matrix::PackedOperand _Operand>
+Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>::~PackedMatrix(void)
+{
+    delete[] p_pack;
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols, Matrix::PackedOperand _Operand>
+Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>& Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>::operator = (const PackedMatrix& _packed2)
+{
+    memcpy(p_pack, _packed2.p_pack, c_elements * sizeof(_Elem));
+    return *this;
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
+template<typename _Elem, size_t _Rows, size_t _Cols, Matrix::PackedOperand _Operand>
+template<typename _ElemB>
+void Matrix::PackedMatrix<_Elem, _Rows, _Cols, _Operand>::Pack(Matrix2D<_ElemB, _Rows, _Cols>& _source)
+{
+    if (_Operand == PackedOperand::Right) Internal::PackRightOperand(&_source[0], _Rows, _Cols, p_pack);
+    else Internal::PackLeftOperand(&_source[0], _Rows, _Cols, p_pack);
+}
+
+template<typename _ElemAlpha, typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemBeta, typename _ElemC>
+void Matrix::Syrk(const _ElemAlpha alpha, Matrix2D<_ElemA, _Rows, _Cols>& A, const _ElemBeta beta, Matrix2D<_ElemC, _Rows, _Rows>& C, const Triangle triangle, const bool mirror)
+{
+    if ((void*)(&A) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to calculate A * A^T "
+        "and input A is the same object as output C. The result will be invalid!" << std::endl;
 
-            return;
-        }
+    Internal::Syrk(&A[0], _Rows, _Cols, &C[0], alpha, beta, triangle);
 
-        // 3x3 * 3x2 -> 3x2
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 2)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
+    if (mirror) Internal::MirrorTriangle(&C[0], _Rows, triangle);
+}
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemC>
+void Matrix::Gram(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemC, _Rows, _Rows>& C, const Triangle triangle, const bool mirror)
+{
+    Matrix::Syrk(_ElemC(1), A, _ElemC(0), C, triangle, mirror);
+}
+
+template<Matrix::Side _Side, Matrix::Triangle _Triangle, Matrix::Diagonal _Diagonal, typename _ElemT, size_t _N, typename _ElemB, size_t _Rows, size_t _Cols, typename _ElemC>
+void Matrix::TriMul(Matrix2D<_ElemT, _N, _N>& T, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    static_assert(_Side != Side::Left or _N == _Rows, "MATRIX ASSERT: Cannot multiply matrices T and B where T.Colums != B.Rows");
+    static_assert(_Side != Side::Right or _N == _Cols, "MATRIX ASSERT: Cannot multiply matrices B and T where B.Colums != T.Rows");
+
+    if (_Side == Side::Left)
+        Internal::ParallelFor(_Cols, Internal::c_tri_block, [&](const size_t begin, const size_t end)
+            {
+                Internal::TriMulLeft<_Triangle, _Diagonal>(&T[0], &B[0], &C[0], _Rows, _Cols, begin, end);
+            });
+    else
+        Internal::ParallelFor(_Rows, 16, [&](const size_t begin, const size_t end)
+            {
+                Internal::TriMulRight<_Triangle, _Diagonal>(&T[0], &B[0], &C[0], _Cols, begin, end);
+            });
+}
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
+template<Matrix::Side _Side, Matrix::Triangle _Triangle, Matrix::Diagonal _Diagonal, typename _ElemT, size_t _N, typename _ElemB, size_t _Rows, size_t _Cols, typename _ElemC>
+void Matrix::TriSolve(Matrix2D<_ElemT, _N, _N>& T, Matrix2D<_ElemB, _Rows, _Cols>& B, Matrix2D<_ElemC, _Rows, _Cols>& C)
+{
+    static_assert(_Side != Side::Left or _N == _Rows, "MATRIX ASSERT: Cannot solve T * X = B where T.Colums != B.Rows");
+    static_assert(_Side != Side::Right or _N == _Cols, "MATRIX ASSERT: Cannot solve X * T = B where B.Colums != T.Rows");
+
+    // the substitution works in place, so start with C = B
+    if ((void*)(&B) != (void*)(&C))
+        for (size_t i = 0; i < _Rows * _Cols; i++)
+            C[i] = _ElemC(B[i]);
+
+    if (_Side == Side::Left)
+        Internal::ParallelFor(_Cols, Internal::c_tri_block, [&](const size_t begin, const size_t end)
+            {
+                Internal::TriSolveLeft<_Triangle, _Diagonal>(&T[0], &C[0], _Rows, _Cols, begin, end);
+            });
+    else
+        Internal::ParallelFor(_Rows, 16, [&](const size_t begin, const size_t end)
+            {
+                Internal::TriSolveRight<_Triangle, _Diagonal>(&T[0], &C[0], _Cols, begin, end);
+            });
+}
+
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB>
+Matrix::KronOperator<_ElemA, _RowsA, _ColsA, _ElemB, _RowsB, _ColsB>::KronOperator(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _RowsB, _ColsB>& B) :
+    r_a(A), r_b(B)
+{}
 
-            return;
-        }
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB>
+template<typename _ElemX, size_t _ColsX, typename _ElemY>
+void Matrix::KronOperator<_ElemA, _RowsA, _ColsA, _ElemB, _RowsB, _ColsB>::Apply(Matrix2D<_ElemX, _ColsA * _ColsB, _ColsX>& X, Matrix2D<_ElemY, _RowsA * _RowsB, _ColsX>& Y)
+{
+    /*
+    Seen as a 3D array, X has the shape [_ColsA][_ColsB][_ColsX] and Y the shape [_RowsA][_RowsB][_ColsX].
+    Then (A (x) B) * X can be calculated with two ordinary multiplications:
 
-        // 3x3 * 3x3 -> 3x3
-        if (_RowsA == 3 and _ColsA == 3 and _RowsB == 3 and _ColsB == 3)
-        {
-            C.at(0, 0) = _ElemC((A.at(0, 0) * B.at(0, 0)) + (A.at(0, 1) * B.at(1, 0)) + (A.at(0, 2) * B.at(2, 0)));
-            C.at(0, 1) = _ElemC((A.at(0, 0) * B.at(0, 1)) + (A.at(0, 1) * B.at(1, 1)) + (A.at(0, 2) * B.at(2, 1)));
-            C.at(0, 2) = _ElemC((A.at(0, 0) * B.at(0, 2)) + (A.at(0, 1) * B.at(1, 2)) + (A.at(0, 2) * B.at(2, 2)));
+        T[j] = B * X[j]     for each of the _ColsA slices of X, T has the shape [_ColsA][_RowsB][_ColsX]
+        Y    = A * T        with T seen as a _ColsA x (_RowsB * _ColsX) matrix
 
-            C.at(1, 0) = _ElemC((A.at(1, 0) * B.at(0, 0)) + (A.at(1, 1) * B.at(1, 0)) + (A.at(1, 2) * B.at(2, 0)));
-            C.at(1, 1) = _ElemC((A.at(1, 0) * B.at(0, 1)) + (A.at(1, 1) * B.at(1, 1)) + (A.at(1, 2) * B.at(2, 1)));
-            C.at(1, 2) = _ElemC((A.at(1, 0) * B.at(0, 2)) + (A.at(1, 1) * B.at(1, 2)) + (A.at(1, 2) * B.at(2, 2)));
+    This needs O(_ColsA * _ColsB * _RowsB * _ColsX + _RowsA * _ColsA * _RowsB * _ColsX) operations instead of
+    O(_RowsA * _RowsB * _ColsA * _ColsB * _ColsX) and never creates A (x) B.
+    */
+    std::vector<_ElemY> tmp(_ColsA * _RowsB * _ColsX);
 
-            C.at(2, 0) = _ElemC((A.at(2, 0) * B.at(0, 0)) + (A.at(2, 1) * B.at(1, 0)) + (A.at(2, 2) * B.at(2, 0)));
-            C.at(2, 1) = _ElemC((A.at(2, 0) * B.at(0, 1)) + (A.at(2, 1) * B.at(1, 1)) + (A.at(2, 2) * B.at(2, 1)));
-            C.at(2, 2) = _ElemC((A.at(2, 0) * B.at(0, 2)) + (A.at(2, 1) * B.at(1, 2)) + (A.at(2, 2) * B.at(2, 2)));
+    for (size_t j = 0; j < _ColsA; j++)
+        Internal::Gemm(&r_b[0], &X[j * _ColsB * _ColsX], tmp.data() + (j * _RowsB * _ColsX), _RowsB, _ColsB, _ColsX);
 
-            return;
-        }
+    Internal::Gemm(&r_a[0], tmp.data(), &Y[0], _RowsA, _ColsA, _RowsB * _ColsX);
+}
 
-    }
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB, typename _ElemX, size_t _ColsX, typename _ElemY>
+void Matrix::Mul(KronOperator<_ElemA, _RowsA, _ColsA, _ElemB, _RowsB, _ColsB>& K, Matrix2D<_ElemX, _ColsA * _ColsB, _ColsX>& X, Matrix2D<_ElemY, _RowsA * _RowsB, _ColsX>& Y)
+{
+    K.Apply(X, Y);
+}
 
-    // Matrices n1x3 * 3xn2
-    if (_ColsA == 3 and _RowsB == 3)
-    {
-        for (size_t rows = 0; rows < _RowsC; rows++)
-            for (size_t cols = 0; cols < _ColsC; cols++)
-                C.at(rows, cols) = _ElemC((A.at(rows, 0) * B.at(0, cols)) + (A.at(rows, 1) * B.at(1, cols)) + (A.at(rows, 2) * B.at(2, cols)));
-        return;
-    }
+template<typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB, typename _ElemC>
+void Matrix::Kron(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _RowsB, _ColsB>& B, Matrix2D<_ElemC, _RowsA * _RowsB, _ColsA * _ColsB>& C)
+{
+    Internal::ParallelFor(_RowsA * _RowsB, 16, [&](const size_t begin, const size_t end)
+        {
+            Internal::KronRows(&A[0], _ColsA, &B[0], _RowsB, _ColsB, &C[0], begin, end);
+        });
+}
 
+template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+void Matrix::BlockDiag(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks)
+{
+    static_assert(Internal::Sum(Internal::MatrixShape<_Blocks>::c_rows...) == _RowsC, "MATRIX ASSERT: The destination matrix must have as many rows as all blocks together!");
+    static_assert(Internal::Sum(Internal::MatrixShape<_Blocks>::c_cols...) == _ColsC, "MATRIX ASSERT: The destination matrix must have as many columns as all blocks together!");
 
+    size_t row0 = 0, col0 = 0;
+    const int expand[] = { 0, (Internal::WriteDiagonalBlock(&C[0], _ColsC, blocks, row0, col0), 0)... };
+    (void)expand;
+}
+
+template<size_t _Row0, size_t _Col0, typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemB, size_t _RowsB, size_t _ColsB>
+void Matrix::ExtractBlock(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemB, _RowsB, _ColsB>& B)
+{
+    static_assert(_Row0 + _RowsB <= _RowsA, "MATRIX ASSERT: The block reaches below the last row of A!");
+    static_assert(_Col0 + _ColsB <= _ColsA, "MATRIX ASSERT: The block reaches behind the last column of A!");
 
-#endif // _MATRIX_MANUAL_OPTIMISATION
+    Internal::CopyBlock(&A[(_Row0 * _ColsA) + _Col0], _ColsA, &B[0], _ColsB, _RowsB, _ColsB);
+}
 
-    // If we don't use [_MATRIX_MANUAL_OPTIMISATION] or for matrices that don't fit
-    // into the cases describes for [_MATRIX_MANUAL_OPTIMISATION]:
+template<size_t _Row0, size_t _Col0, typename _ElemA, size_t _RowsA, size_t _ColsA, typename _ElemC, size_t _RowsC, size_t _ColsC>
+void Matrix::InsertBlock(Matrix2D<_ElemA, _RowsA, _ColsA>& A, Matrix2D<_ElemC, _RowsC, _ColsC>& C)
+{
+    static_assert(_Row0 + _RowsA <= _RowsC, "MATRIX ASSERT: The block reaches below the last row of C!");
+    static_assert(_Col0 + _ColsA <= _ColsC, "MATRIX ASSERT: The block reaches behind the last column of C!");
 
-    // clear destination for preparation
-    memset(&C[0], 0, _ColsC * _RowsC * sizeof(_ElemC));
+    Internal::CopyBlock(&A[0], _ColsA, &C[(_Row0 * _ColsC) + _Col0], _ColsC, _RowsA, _ColsA);
+}
 
-    // Now multiply all and add to corresponding index
-    for (size_t rowsA = 0, index = 0; rowsA < _RowsA; rowsA++)
-        for (size_t colsB = 0; colsB < _ColsB; colsB++, index++)
-            for (size_t rowCol = 0; rowCol < _ColsA; rowCol++)
-                C[index] += _ElemC(A.at(rowsA, rowCol) * B.at(rowCol, colsB));
+template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+void Matrix::HStack(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks)
+{
+    static_assert(Internal::AllEqual(_RowsC, Internal::MatrixShape<_Blocks>::c_rows...), "MATRIX ASSERT: All blocks must have as many rows as the destination matrix!");
+    static_assert(Internal::Sum(Internal::MatrixShape<_Blocks>::c_cols...) == _ColsC, "MATRIX ASSERT: The destination matrix must have as many columns as all blocks together!");
+
+    size_t col0 = 0;
+    const int expand[] = { 0, (Internal::WriteHStackBlock(&C[0], _ColsC, blocks, col0), 0)... };
+    (void)expand;
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+template<typename _ElemC, size_t _RowsC, size_t _ColsC, typename... _Blocks>
+void Matrix::VStack(Matrix2D<_ElemC, _RowsC, _ColsC>& C, _Blocks&... blocks)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _ElemC(A[i] + B[i]);
+    static_assert(Internal::AllEqual(_ColsC, Internal::MatrixShape<_Blocks>::c_cols...), "MATRIX ASSERT: All blocks must have as many columns as the destination matrix!");
+    static_assert(Internal::Sum(Internal::MatrixShape<_Blocks>::c_rows...) == _RowsC, "MATRIX ASSERT: The destination matrix must have as many rows as all blocks together!");
+
+    size_t row0 = 0;
+    const int expand[] = { 0, (Internal::WriteVStackBlock(&C[0], _ColsC, blocks, row0), 0)... };
+    (void)expand;
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::Add(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::Convert(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const Conversion method)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(A[i] + scalar);
+    Internal::Convert(&A[0], &B[0], _Rows * _Cols, method);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::SortRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const SortOrder order)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _ElemC(A[i] - B[i]);
+    Internal::Convert(&A[0], &B[0], _Rows * _Cols, Conversion::Truncate);
+    Internal::SortEachRow(&B[0], _Rows, _Cols, order);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::Sub(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::SortCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B, const SortOrder order)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(A[i] - scalar);
+    // the columns are sorted as the rows of the transpose, so every sort works on contiguous memory
+    std::vector<_ElemB> transposed(_Rows * _Cols);
+    Internal::TransposeStrided(&A[0], _Cols, transposed.data(), _Rows, _Rows, _Cols);
+    Internal::SortEachRow(transposed.data(), _Cols, _Rows, order);
+    Internal::TransposeStrided(transposed.data(), _Rows, &B[0], _Cols, _Cols, _Rows);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::Sub(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _Elem, size_t _Rows, size_t _Cols, typename _Index>
+void Matrix::ArgSortRows(Matrix2D<_Elem, _Rows, _Cols>& A, Matrix2D<_Index, _Rows, _Cols>& indices, const SortOrder order)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(scalar - A[i]);
+    static_assert(std::is_integral<_Index>::value, "MATRIX ASSERT: The column indices must be an integral type!");
+
+    if (order == SortOrder::Ascending) Internal::ArgSortEachRow<SortOrder::Ascending>(&A[0], &indices[0], _Rows, _Cols);
+    else Internal::ArgSortEachRow<SortOrder::Descending>(&A[0], &indices[0], _Rows, _Cols);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, size_t _K, typename _Index>
+void Matrix::TopKPerRow(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _K>& B, Matrix2D<_Index, _Rows, _K>& indices, const SortOrder order)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _ElemC(A[i] * B[i]);
+    static_assert(_K > 0 and _K <= _Cols, "MATRIX ASSERT: k must be between 1 and the column count of A!");
+    static_assert(std::is_integral<_Index>::value, "MATRIX ASSERT: The column indices must be an integral type!");
+
+    if (order == SortOrder::Ascending) Internal::TopKEachRow<SortOrder::Ascending>(&A[0], &B[0], &indices[0], _Rows, _Cols, _K);
+    else Internal::TopKEachRow<SortOrder::Descending>(&A[0], &B[0], &indices[0], _Rows, _Cols, _K);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::MulEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::CumSumRows(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(A[i] * scalar);
+    const _ElemA* a = &A[0];
+    _ElemB* b = &B[0];
+
+    Internal::ParallelFor(_Rows, std::max<size_t>(Internal::ParallelThreshold() / _Cols, 1), [=](const size_t begin, const size_t end)
+        {
+            for (size_t row = begin; row < end; row++)
+                Internal::ScanRow(a + (row * _Cols), (const _ElemB*)nullptr, b + (row * _Cols), _Cols);
+        });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::CumSumCols(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _ElemC(A[i] / B[i]);
+    Internal::ScanDown(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* a, const _ElemB* prev, _ElemB* b)
+        {
+            if (prev) Internal::ElementwiseRange<Internal::OpAdd>(prev, a, b, _Cols, false);
+            else Internal::CopyRow(a, b, _Cols);
+        });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::DivEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
+void Matrix::IntegralImage(Matrix2D<_ElemA, _Rows, _Cols>& A, Matrix2D<_ElemB, _Rows, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(A[i] / scalar);
+    // the row sums and the column sums are calculated in one pass, the row above is still in the cache
+    Internal::ScanDown(&A[0], &B[0], _Rows, _Cols, [](const _ElemA* a, const _ElemB* prev, _ElemB* b)
+        { Internal::ScanRow(a, prev, b, _Cols); });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::DivEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _Elem, size_t _Rows, size_t _Cols>
+_Elem Matrix::BoxSum(Matrix2D<_Elem, _Rows, _Cols>& integral, const size_t row0, const size_t col0, const size_t rows, const size_t cols)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(scalar / A[i]);
+    if (rows == 0 or cols == 0)
+        return _Elem(0);
+
+    const size_t bottom = row0 + rows - 1;
+    const size_t right = col0 + cols - 1;
+
+    // unsigned sums wrap around in between, but the result is right as long as it fits
+    _Elem sum = integral.at(bottom, right);
+    if (row0 > 0) sum = _Elem(sum - integral.at(row0 - 1, right));
+    if (col0 > 0) sum = _Elem(sum - integral.at(bottom, col0 - 1));
+    if (row0 > 0 and col0 > 0) sum = _Elem(sum + integral.at(row0 - 1, col0 - 1));
+    return sum;
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B, Matrix2D<_ElemC, _Rows, _Cols>&C)
+template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, size_t _RowsB, typename _ElemB>
+void Matrix::GatherRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsB, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        C[i] = _ElemC(std::pow(A[i], B[i]));
+    static_assert(std::is_integral<_Index>::value, "MATRIX ASSERT: The row indices must be an integral type!");
+
+    const _ElemA* a = &A[0];
+    const _Index* index = &indices[0];
+    _ElemB* b = &B[0];
+
+    Internal::CheckRowIndices(index, _RowsB, _RowsA, "GatherRows()");
+
+    Internal::ParallelFor(_RowsB, std::max<size_t>(Internal::ParallelThreshold() / _Cols, 1), [=](const size_t begin, const size_t end)
+        {
+            for (size_t row = begin; row < end; row++)
+            {
+                if (row + Internal::c_prefetch_rows < end and size_t(index[row + Internal::c_prefetch_rows]) < _RowsA)
+                    Internal::PrefetchRow(a + (size_t(index[row + Internal::c_prefetch_rows]) * _Cols), _Cols);
+
+                // the same as the scatter functions, which never touch rows of invalid indices
+                if (size_t(index[row]) < _RowsA)
+                    Internal::CopyRow(a + (size_t(index[row]) * _Cols), b + (row * _Cols), _Cols);
+            }
+        });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::PowEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, const _ElemB scalar, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, typename _ElemB, size_t _RowsB>
+void Matrix::ScatterRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsA, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(std::pow(A[i], scalar));
+    static_assert(std::is_integral<_Index>::value, "MATRIX ASSERT: The row indices must be an integral type!");
+
+    Internal::CheckRowIndices(&indices[0], _RowsA, _RowsB, "ScatterRows()");
+    Internal::Scatter(&indices[0], _RowsA, &A[0], &B[0], _RowsB, _Cols, [](_ElemB* b, const _ElemA* a)
+        { Internal::CopyRow(a, b, _Cols); });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB, typename _ElemC>
-void Matrix::PowEBE(const _ElemA scalar, Matrix2D<_ElemB, _Rows, _Cols>&A, Matrix2D<_ElemC, _Rows, _Cols>&B)
+template<typename _ElemA, size_t _RowsA, size_t _Cols, typename _Index, typename _ElemB, size_t _RowsB>
+void Matrix::ScatterAddRows(Matrix2D<_ElemA, _RowsA, _Cols>& A, Matrix2D<_Index, _RowsA, 1>& indices, Matrix2D<_ElemB, _RowsB, _Cols>& B)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemC(std::pow(scalar, A[i]));
+    static_assert(std::is_integral<_Index>::value, "MATRIX ASSERT: The row indices must be an integral type!");
+
+    Internal::CheckRowIndices(&indices[0], _RowsA, _RowsB, "ScatterAddRows()");
+    Internal::Scatter(&indices[0], _RowsA, &A[0], &B[0], _RowsB, _Cols, [](_ElemB* b, const _ElemA* a)
+        { Internal::ElementwiseRange<Internal::OpAdd>(b, a, b, _Cols, false); });
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-void Matrix::ExpEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B)
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::SplitComplexMatrix<_Elem, _Rows, _Cols>::SplitComplexMatrix(void) :
+    m_real(_Elem(0)), m_imag(_Elem(0))
+{}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::SplitComplexMatrix<_Elem, _Rows, _Cols>::SplitComplexMatrix(Matrix2D<std::complex<_Elem>, _Rows, _Cols>& _initilizer) :
+    m_real(_Elem(0)), m_imag(_Elem(0))
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemB(std::exp(A[i]));
+    Internal::Deinterleave(&_initilizer[0], &m_real[0], &m_imag[0], _Rows * _Cols);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-void Matrix::SqrtEBE(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B)
+template<typename _Elem, size_t _RowsA, size_t _ColsA, size_t _ColsB>
+void Matrix::Mul(Matrix2D<std::complex<_Elem>, _RowsA, _ColsA>& A, Matrix2D<std::complex<_Elem>, _ColsA, _ColsB>& B, Matrix2D<std::complex<_Elem>, _RowsA, _ColsB>& C, const ComplexMethod method)
 {
-    for (size_t i = 0; i < _Rows * _Cols; i++)
-        B[i] = _ElemB(std::sqrt(A[i]));
+    if ((void*)(&A) == (void*)(&C) or (void*)(&B) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+        "and an input is the same object as output C. If and input is the same as "
+        "an output, the multiplication may fail and give an invalid result!" << std::endl;
+
+    if (_RowsA < _MATRIX_PACKED_MUL_MIN_ROWS)
+    {
+        Internal::GemmComplexDirect(&A[0], &B[0], &C[0], _RowsA, _ColsA, _ColsB);
+        return;
+    }
+
+    // bigger matrices are split into real and imaginary planes and multiplied by the real kernel
+    std::vector<_Elem> a(2 * _RowsA * _ColsA), b(2 * _ColsA * _ColsB), c(2 * _RowsA * _ColsB);
+    Internal::Deinterleave(&A[0], a.data(), a.data() + (_RowsA * _ColsA), _RowsA * _ColsA);
+    Internal::Deinterleave(&B[0], b.data(), b.data() + (_ColsA * _ColsB), _ColsA * _ColsB);
+
+    Internal::GemmSplitComplex(a.data(), a.data() + (_RowsA * _ColsA), b.data(), b.data() + (_ColsA * _ColsB), c.data(), c.data() + (_RowsA * _ColsB),
+        _RowsA, _ColsA, _ColsB, method);
+
+    Internal::Interleave(c.data(), c.data() + (_RowsA * _ColsB), &C[0], _RowsA * _ColsB);
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-void Matrix::Transpose90deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Cols, _Rows>&B)
+template<typename _Elem, size_t _RowsA, size_t _ColsA, size_t _ColsB>
+void Matrix::Mul(SplitComplexMatrix<_Elem, _RowsA, _ColsA>& A, SplitComplexMatrix<_Elem, _ColsA, _ColsB>& B, SplitComplexMatrix<_Elem, _RowsA, _ColsB>& C, const ComplexMethod method)
 {
-    constexpr auto c_width = (_Rows * _Cols);
+    if ((void*)(&A) == (void*)(&C) or (void*)(&B) == (void*)(&C)) std::cerr << "MATRIX WARNING: You are trying to multiply two Matrices "
+        "and an input is the same object as output C. If and input is the same as "
+        "an output, the multiplication may fail and give an invalid result!" << std::endl;
 
-    constexpr auto _RowsA = _Rows;
-    constexpr auto _ColsA = _Cols;
-    constexpr auto _RowsB = _Cols;
-    constexpr auto _ColsB = _Rows;
-    constexpr auto a = _ColsA;
-    constexpr auto b = _ColsB;
+    Internal::GemmSplitComplex(&A.real()[0], &A.imag()[0], &B.real()[0], &B.imag()[0], &C.real()[0], &C.imag()[0], _RowsA, _ColsA, _ColsB, method);
+}
 
-    for (size_t i = 0; i < c_width; i++)
-        B[i] = _ElemB(A[(((a * b) - a) - (a * i)) + ((i / b) * (b * a)) + (i / b)]);
+template<typename _Elem, size_t _Rows, size_t _Cols>
+void Matrix::ToSplit(Matrix2D<std::complex<_Elem>, _Rows, _Cols>& A, SplitComplexMatrix<_Elem, _Rows, _Cols>& B)
+{
+    Internal::Deinterleave(&A[0], &B.real()[0], &B.imag()[0], _Rows * _Cols);
+}
 
-    //B = p_tmp;
+template<typename _Elem, size_t _Rows, size_t _Cols>
+void Matrix::FromSplit(SplitComplexMatrix<_Elem, _Rows, _Cols>& A, Matrix2D<std::complex<_Elem>, _Rows, _Cols>& B)
+{
+    Internal::Interleave(&A.real()[0], &A.imag()[0], &B[0], _Rows * _Cols);
+}
+
+template<size_t _Rows, size_t _Cols>
+Matrix::Mask2D<_Rows, _Cols>::Mask2D(const bool value) :
+    p_words(new uint64_t[c_words])
+{
+    *this = value;
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-void Matrix::Transpose180deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Rows, _Cols>&B)
+template<size_t _Rows, size_t _Cols>
+Matrix::Mask2D<_Rows, _Cols>::Mask2D(const Mask2D& _initilizer) :
+    p_words(new uint64_t[c_words])
 {
-    constexpr auto c_width = (_Rows * _Cols);
+    memcpy(p_words, _initilizer.p_words, c_words * sizeof(uint64_t));
+}
 
-    for (size_t i = 0; i < c_width; i++)
-        B[i] = _ElemB(A[(c_width - 1) - i]);
+template<size_t _Rows, size_t _Cols>
+Matrix::Mask2D<_Rows, _Cols>::~Mask2D(void)
+{
+    delete[] p_words;
 }
 
-template<typename _ElemA, size_t _Rows, size_t _Cols, typename _ElemB>
-void Matrix::Transpose270deg(Matrix2D<_ElemA, _Rows, _Cols>&A, Matrix2D<_ElemB, _Cols, _Rows>&B)
+template<size_t _Rows, size_t _Cols>
+Matrix::Mask2D<_Rows, _Cols>& Matrix::Mask2D<_Rows, _Cols>::operator = (const Mask2D& _other)
 {
-    constexpr auto c_width = (_Rows * _Cols);
+    memcpy(p_words, _other.p_words, c_words * sizeof(uint64_t));
+    return *this;
+}
 
-    constexpr auto _RowsA = _Rows;
-    constexpr auto _ColsA = _Cols;
-    constexpr auto _RowsB = _Cols;
-    constexpr auto _ColsB = _Rows;
-    constexpr auto a = _ColsA;
-    constexpr auto b = _ColsB;
+template<size_t _Rows, size_t _Cols>
+Matrix::Mask2D<_Rows, _Cols>& Matrix::Mask2D<_Rows, _Cols>::operator = (const bool value)
+{
+    std::fill(p_words, p_words + c_words, value ? ~uint64_t(0) : uint64_t(0));
 
-    for (size_t i = 0; i < c_width; i++)
-        B[i] = _ElemB(A[(i * a) - ((i / b) * (b * a + 1)) + (a - 1)]);
-}
+    // the bits behind the last element stay 0, so CountTrue() can count whole words
+    if (value and (c_elements % 64) != 0)
+        p_words[c_words - 1] = (uint64_t(1) << (c_elements % 64)) - 1;
+    return *this;
+}
+
+template<size_t _Rows, size_t _Cols>
+void Matrix::Mask2D<_Rows, _Cols>::set(const size_t index, const bool value)
+{
+    const uint64_t bit = uint64_t(1) << (index % 64);
+    if (value)
+        p_words[index / 64] |= bit;
+    else
+        p_words[index / 64] &= ~bit;
+}
+
+template<typename _Elem, size_t _Rows, size_t _Cols>
+Matrix::MatrixView<_Elem, _Rows, _Cols>::MatrixView(_Elem* base, const ptrdiff_t row_stride, const ptrdiff_t col_stride) :
+    p_base(base),
+    m_row_stride(row_stride),
+    m_col_stride(col_stride)
+{}
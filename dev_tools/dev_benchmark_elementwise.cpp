@@ -0,0 +1,63 @@
+#include "../Matrix_Combined.h"
+#include <chrono>
+#include <iostream>
+
+// Measures the throughput of the element-by-element functions for mixed type combinations
+// against a plain scalar loop. Build with optimizations and the instruction set of your CPU,
+// e.g. "g++ -O2 -march=native dev_benchmark_elementwise.cpp".
+
+using namespace Matrix;
+
+constexpr size_t c_rows = 2048;
+constexpr size_t c_cols = 2048;
+constexpr int c_repetitions = 20;
+
+template <typename _Func>
+double MeasureSeconds(_Func&& func)
+{
+    func(); // warm up, so the pages of the destination are already mapped
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < c_repetitions; i++)
+        func();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count() / c_repetitions;
+}
+
+template <typename _ElemA, typename _ElemB, typename _ElemC>
+void BenchmarkAdd(const char* name)
+{
+    Matrix2D<_ElemA, c_rows, c_cols> A = _ElemA(3);
+    Matrix2D<_ElemB, c_rows, c_cols> B = _ElemB(5);
+    Matrix2D<_ElemC, c_rows, c_cols> C = _ElemC(0);
+
+    const double scalar = MeasureSeconds([&]()
+        {
+            _ElemA* volatile a = &A[0]; // volatile pointer keeps the compiler from merging both loops
+            for (size_t i = 0; i < c_rows * c_cols; i++)
+                C[i] = _ElemC(a[i] + B[i]);
+        });
+
+    const double kernel = MeasureSeconds([&]() { Add(A, B, C); });
+
+    const double bytes = double(c_rows * c_cols) * (sizeof(_ElemA) + sizeof(_ElemB) + sizeof(_ElemC));
+
+    std::cout << std::left << std::setw(28) << name
+        << " scalar: " << std::setw(8) << std::setprecision(3) << (bytes / scalar) * 1e-9 << " GB/s"
+        << "   Add(): " << std::setw(8) << std::setprecision(3) << (bytes / kernel) * 1e-9 << " GB/s"
+        << "   speedup: " << std::setprecision(3) << scalar / kernel << std::endl;
+}
+
+int main()
+{
+    std::cout << "Add() on " << c_rows << 'x' << c_cols << " matrices" << std::endl;
+
+    BenchmarkAdd<float, float, float>("float + float -> float");
+    BenchmarkAdd<double, double, double>("double + double -> double");
+    BenchmarkAdd<uint8_t, float, float>("uint8 + float -> float");
+    BenchmarkAdd<int32_t, float, float>("int + float -> float");
+    BenchmarkAdd<int32_t, double, float>("int + double -> float");
+
+    return 0;
+}